@@ -39,6 +39,7 @@ from .range_values import RangeValues
 from .potential_iterator import PotentialIterator
 from .pure_expressions import PureExpressions
 from .scope import Scope
+from .thread_escape import ThreadEscape
 from .use_def_chain import UseDefChain
 from .use_omp import UseOMP
 from .yield_points import YieldPoints
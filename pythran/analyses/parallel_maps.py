@@ -9,18 +9,23 @@ from pythran.tables import MODULES
 
 class ParallelMaps(ModuleAnalysis):
 
-    """Yields the est of maps that could be parallel."""
+    """Yields the set of maps that could be parallel."""
 
     def __init__(self):
         self.result = set()
         super(ParallelMaps, self).__init__(PureExpressions, Aliases)
 
     def visit_Call(self, node):
-        if all(alias == MODULES['__builtin__']['map']
-               for alias in self.aliases[node.func]):
-            if all(f in self.pure_expressions
-                   for f in self.aliases[node.args[0]]):
+        func_aliases = self.aliases[node.func]
+        if func_aliases and all(alias == MODULES['__builtin__']['map']
+                                for alias in func_aliases):
+            op_aliases = self.aliases[node.args[0]]
+            # map(None, ...) only zips its arguments
+            if (op_aliases and
+                    MODULES['__builtin__']['None'] not in op_aliases and
+                    all(f in self.pure_expressions for f in op_aliases)):
                 self.result.add(node)
+        self.generic_visit(node)
 
     def display(self, data):
         for node in data:
@@ -0,0 +1,114 @@
+"""
+ThreadEscape detects values that may be shared between threads
+"""
+
+from pythran.analyses.aliases import Aliases
+from pythran.analyses.global_declarations import GlobalDeclarations
+from pythran.analyses.local_declarations import LocalNodeDeclarations
+from pythran.openmp import OMPDirective
+from pythran.passmanager import ModuleAnalysis
+from pythran.tables import MODULES
+from pythran.types.conversion import PYTYPE_TO_CTYPE_TABLE
+from pythran import metadata
+
+import gast as ast
+
+# C++ types of the values that hold no reference count
+SCALAR_CTYPES = {ctype for pytype, ctype in PYTYPE_TO_CTYPE_TABLE.items()
+                 if pytype is not str}
+
+
+class ThreadEscape(ModuleAnalysis):
+
+    """
+    Tells whether a reference counted value may be reached by several threads
+
+    A value escapes its thread when an OpenMP region uses a variable bound
+    out of it, when a function called from such a region returns a global
+    variable, or when numpy.fromfunction or a parallel map runs its functor
+    in parallel.
+    Variables typed as scalars hold no reference count and are harmless,
+    any other variable is assumed to escape.
+    """
+
+    def __init__(self):
+        # imported here because the typing relies on the analyses
+        from pythran.types.types import Types
+        self.result = False
+        super(ThreadEscape, self).__init__(GlobalDeclarations, Aliases, Types)
+
+    def is_scalar(self, node):
+        def scalar_type(t):
+            if hasattr(t, 'iscombined') and t.iscombined():
+                return all(scalar_type(s) for s in t.types)
+            return getattr(t, 'srepr', t) in SCALAR_CTYPES
+        return node in self.types and scalar_type(self.types[node])
+
+    def returns_shared(self, name, visited):
+        """ Whether calling the global `name' may return a shared value. """
+        node = self.global_declarations.get(name)
+        if not isinstance(node, ast.FunctionDef) or name in visited:
+            return False
+        visited.add(name)
+        for n in ast.walk(node):
+            if isinstance(n, ast.Return):
+                if (metadata.get(n, metadata.StaticReturn) and
+                        not self.is_scalar(n.value)):
+                    return True
+            elif isinstance(n, ast.Name):
+                if self.returns_shared(n.id, visited):
+                    return True
+        return False
+
+    @staticmethod
+    def bound_out_of(node, region):
+        """
+        Variables bound in `node' out of `region', arguments included.
+
+        The bindings of an enclosing region are out of a nested one, such as
+        a task spawned from a single region, whose thread may differ.
+        """
+        bound = set()
+        todo = [node]
+        while todo:
+            n = todo.pop()
+            if n is region:
+                continue
+            if isinstance(n, ast.Name) and not isinstance(n.ctx, ast.Load):
+                bound.add(n.id)
+            todo.extend(ast.iter_child_nodes(n))
+        return bound
+
+    def visit_FunctionDef(self, node):
+        # declarations attached to the function itself are not handled
+        if metadata.get(node, OMPDirective):
+            self.result = True
+
+        regions = {n for n in ast.walk(node)
+                   if n is not node and metadata.get(n, OMPDirective)}
+        if not regions:
+            return self.generic_visit(node)
+
+        # the declaration of a variable holds its type
+        decls = {n.id: n for n in
+                 self.passmanager.gather(LocalNodeDeclarations, node)}
+        decls.update((arg.id, arg) for arg in node.args.args)
+
+        for region in regions:
+            outer = self.bound_out_of(node, region)
+            for n in ast.walk(region):
+                if not isinstance(n, ast.Name):
+                    continue
+                if n.id in outer:
+                    if not self.is_scalar(decls.get(n.id)):
+                        self.result = True
+                elif self.returns_shared(n.id, set()):
+                    self.result = True
+        self.generic_visit(node)
+
+    def visit_Call(self, node):
+        parallel = (MODULES['numpy']['fromfunction'],
+                    MODULES['__builtin__']['pythran']['parallel_map'])
+        if any(alias in parallel for alias in self.aliases[node.func]):
+            self.result = True
+        self.generic_visit(node)
@@ -1215,23 +1215,26 @@ class Cxx(Backend):
     #include <pythonic/include/types/str.hpp>
     #include <pythonic/__builtin__/print.hpp>
     #include <pythonic/types/str.hpp>
-    namespace __pythran_test
+    namespace
     {
-      struct foo
+      namespace __pythran_test
       {
-        typedef void callable;
-        ;
-        struct type
+        struct foo
         {
-          typedef typename pythonic::returnable<pythonic::types::none_type>\
+          typedef void callable;
+          ;
+          struct type
+          {
+            typedef typename pythonic::returnable<pythonic::types::none_type>\
 ::type result_type;
+          }  ;
+          typename type::result_type operator()() const;
+          ;
         }  ;
-        typename type::result_type operator()() const;
-        ;
-      }  ;
-      typename foo::type::result_type foo::operator()() const
-      {
-        pythonic::__builtin__::print("hello world");
+        typename foo::type::result_type foo::operator()() const
+        {
+          pythonic::__builtin__::print("hello world");
+        }
       }
     }
     """
@@ -1256,7 +1259,9 @@ class Cxx(Backend):
 
         nsbody = [s for ls in decls + defns for s in ls]
         ns = Namespace(pythran_ward + self.passmanager.module_name, nsbody)
-        self.result = CompilationUnit(headers + [ns])
+        # internal linkage, so that each translation unit of a module split
+        # into several ones holds its own copy
+        self.result = CompilationUnit(headers + [Namespace('', [ns])])
 
     def visit_FunctionDef(self, node):
         yields = self.passmanager.gather(YieldPoints, node)
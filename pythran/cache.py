@@ -0,0 +1,232 @@
+'''
+This module contains an on-disk cache of compiled native modules
+    * cache_key: key of the compilation of a C++ file
+    * lookup: path of the cached module of a key, if any
+    * store: add a module to the cache, evicting the least recently used ones
+'''
+
+from pythran.config import cfg, compiler
+from pythran.version import __version__
+
+from distutils.ccompiler import gen_lib_options, gen_preprocess_options
+from distutils.sysconfig import get_python_inc
+from numpy.distutils.ccompiler import new_compiler
+import glob
+import hashlib
+import logging
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+import numpy
+
+logger = logging.getLogger('pythran')
+
+# generated modules hold their generation date in their ``__pythran__``
+# metadata, which is not part of the key
+_generation_date = re.compile(br'(theDoc = Py_BuildValue\("\(sss\)",\s*'
+                              br'"[^"]*",\s*)"[^"]*"')
+
+_memo = {}
+
+
+def _memoize(f):
+    def wrapper():
+        if f not in _memo:
+            _memo[f] = f()
+        return _memo[f]
+    return wrapper
+
+
+@_memoize
+def _compiler_id():
+    ''' Path and version of the C++ compiler. '''
+    cxx = compiler()
+    try:
+        version = subprocess.check_output(cxx.split() + ['--version'],
+                                          stderr=subprocess.STDOUT)
+    except (OSError, subprocess.CalledProcessError):
+        version = b''
+    return cxx.encode() + b'\0' + version
+
+
+@_memoize
+def _headers_digest():
+    ''' Digest of the pythonic headers. '''
+    digest = hashlib.sha256()
+    root = os.path.join(os.path.dirname(__file__), 'pythonic')
+    for dirpath, dirnames, filenames in os.walk(root):
+        dirnames.sort()
+        for filename in sorted(filenames):
+            path = os.path.join(dirpath, filename)
+            digest.update(os.path.relpath(path, root).encode() + b'\0')
+            with open(path, 'rb') as fd:
+                digest.update(fd.read())
+    return digest.digest()
+
+
+@_memoize
+def _cxx_compiler():
+    ''' Compiler distutils builds C++ extensions with, None if it does not
+    take gcc options. '''
+    compiler = new_compiler()
+    if compiler.compiler_type != 'unix':
+        return None
+    compiler.customize(None, need_cxx=True)
+    # numpy.distutils compiles and links C++ sources with the C++ compiler
+    return compiler.cxx_compiler()
+
+
+def _compile_command(extension_args):
+    '''
+    Command compiling C++ code with the flags distutils uses for
+    `extension_args`, None if the compiler does not take gcc options.
+    '''
+    compiler = _cxx_compiler()
+    if compiler is None:
+        return None
+    macros = (extension_args['define_macros'] +
+              [(undef,) for undef in extension_args['undef_macros']])
+    include_dirs = (extension_args['include_dirs'] +
+                    [get_python_inc(), get_python_inc(plat_specific=1)])
+    return (compiler.compiler_so +
+            gen_preprocess_options(macros, include_dirs) +
+            extension_args['extra_compile_args'])
+
+
+def _link_command(extension_args):
+    '''
+    Command linking a native module with the flags distutils uses for
+    `extension_args`, None if the compiler does not take gcc options.
+    '''
+    compiler = _cxx_compiler()
+    if compiler is None:
+        return None
+    return (compiler.linker_so +
+            gen_lib_options(compiler, extension_args['library_dirs'], [],
+                            extension_args['libraries']) +
+            extension_args['extra_link_args'])
+
+
+def cache_dir():
+    ''' Directory of the cache, None if it is disabled. '''
+    if not cfg.getint('pythran', 'cache_size'):
+        return None
+    path = cfg.get('pythran', 'cache_dir')
+    if not path:
+        path = os.path.join(os.environ.get('XDG_CACHE_HOME', '~/.cache'),
+                            'pythran')
+    return os.path.expanduser(path)
+
+
+def cache_key(module_name, cxxfiles, extension_args):
+    '''
+    Key of the compilation of the translation units `cxxfiles` to the native
+    module `module_name` with the distutils extension arguments
+    `extension_args`.
+
+    It covers the C++ code, the compiler, the compile and link commands
+    distutils runs, the installed pythonic headers and the versions of
+    Pythran, Python and Numpy.
+    '''
+    digest = hashlib.sha256()
+    for cxxfile in cxxfiles:
+        with open(cxxfile, 'rb') as fd:
+            content = _generation_date.sub(br'\1""', fd.read())
+        digest.update(hashlib.sha256(content).digest())
+    for part in (module_name, repr(sorted(extension_args.items())),
+                 repr(_compile_command(extension_args)),
+                 repr(_link_command(extension_args)),
+                 __version__, sys.version, numpy.__version__):
+        digest.update(b'\0' + part.encode('utf-8'))
+    digest.update(_compiler_id())
+    digest.update(_headers_digest())
+    return digest.hexdigest()
+
+
+def lookup(key):
+    '''
+    Path of the module cached under `key`, None if there is none.
+    '''
+    directory = cache_dir()
+    if directory is None:
+        return None
+    candidates = glob.glob(os.path.join(directory, key + '.*'))
+    if not candidates:
+        return None
+    cached = candidates[0]
+    try:
+        # the modification time tracks the last use, for the eviction
+        os.utime(cached, None)
+    except OSError:
+        # evicted meanwhile
+        return None
+    logger.info("Reusing cached module: " + cached)
+    return cached
+
+
+def store(key, binary):
+    '''
+    Add a copy of `binary` to the cache, under `key`, then remove the least
+    recently used modules until the cache fits `cache_size` megabytes.
+    '''
+    directory = cache_dir()
+    if directory is None:
+        return
+    try:
+        if not os.path.isdir(directory):
+            os.makedirs(directory)
+        # copy then rename, so that concurrent lookups never see a partial
+        # module
+        fd, tmp = tempfile.mkstemp(dir=directory, suffix='.tmp')
+        os.close(fd)
+    except (IOError, OSError) as e:
+        logger.warn("Cannot cache module: " + str(e))
+        return
+    try:
+        shutil.copy(binary, tmp)
+        os.rename(tmp, os.path.join(directory,
+                                    key + os.path.splitext(binary)[1]))
+    except (IOError, OSError) as e:
+        logger.warn("Cannot cache module: " + str(e))
+        os.remove(tmp)
+        return
+    evict(directory, cfg.getint('pythran', 'cache_size') * 2 ** 20)
+
+
+def _size(path):
+    ''' Size of the file or of the files of the directory at `path`. '''
+    if not os.path.isdir(path):
+        return os.stat(path).st_size
+    return sum(os.stat(os.path.join(dirpath, filename)).st_size
+               for dirpath, _, filenames in os.walk(path)
+               for filename in filenames)
+
+
+def evict(directory, max_size):
+    ''' Remove the least recently used entries from `directory` until they
+    take at most `max_size` bytes. '''
+    entries = []
+    for path in glob.glob(os.path.join(directory, '*')):
+        # modules being stored
+        if path.endswith('.tmp'):
+            continue
+        try:
+            entries.append((os.stat(path).st_mtime, _size(path), path))
+        except OSError:
+            continue
+    total = sum(size for _, size, _ in entries)
+    for _, size, path in sorted(entries):
+        if total <= max_size:
+            break
+        try:
+            if os.path.isdir(path):
+                shutil.rmtree(path)
+            else:
+                os.remove(path)
+        except OSError:
+            pass
+        total -= size
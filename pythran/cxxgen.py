@@ -403,7 +403,7 @@ class Namespace(Block):
         self.name = name
 
     def generate(self):
-        yield "namespace " + self.name
+        yield "namespace " + self.name if self.name else "namespace"
         yield "{"
         for item in self.contents:
             for item_line in item.generate():
@@ -454,6 +454,7 @@ class PythonModule(object):
         self.capsules = []
         self.python_implems = []
         self.wrappers = []
+        self.exported = {}
         self.docstrings = docstrings
 
         self.metadata = metadata
@@ -481,6 +482,25 @@ class PythonModule(object):
     def add_function(self, func, name, types, signature):
         self.add_function_to(self.implems, fun, name, types, signature)
 
+    wrapper_code = dedent('''
+        {linkage} PyObject *
+        {wname}(PyObject * const *args_obj)
+        {{
+            return to_python({name}({args}));
+        }}
+
+        {linkage} bool
+        {aname}(PyObject * const *args_obj, Py_ssize_t nargs)
+        {{
+            return {checks};
+        }}''')
+
+    wrapper_declaration = dedent('''
+        PYTHRAN_UNIT_LINKAGE PyObject *
+        {wname}(PyObject * const *args_obj);
+        PYTHRAN_UNIT_LINKAGE bool
+        {aname}(PyObject * const *args_obj, Py_ssize_t nargs);''')
+
     def add_function_to(self, to, func, name, ctypes, signature):
         """
         Add a function to be exposed. *func* is expected to be a
@@ -494,53 +514,27 @@ class PythonModule(object):
         to.append(func)
 
         args_unboxing = []  # turns PyObject to c++ object
-        args_checks = []  # check if the above conversion is valid
+        # check if the above conversion is valid
+        args_checks = ['nargs == {}'.format(len(ctypes))]
         wrapper_name = pythran_ward + 'wrap_' + func.fdecl.name
+        accepts_name = pythran_ward + 'accepts_' + func.fdecl.name
 
         for i, t in enumerate(ctypes):
             args_unboxing.append('from_python<{}>(args_obj[{}])'.format(t, i))
             args_checks.append('is_convertible<{}>(args_obj[{}])'.format(t, i))
-        if ctypes:
-            arg_decls = func.fdecl.arg_decls[:len(ctypes)]
-            keywords = ",".join('"{}"'.format(arg.name) for arg in arg_decls)
-            wrapper = dedent('''
-                static PyObject *
-                {wname}(PyObject *self, PyObject *args, PyObject *kw)
-                {{
-                    PyObject* args_obj[{size}+1];
-                    char const* keywords[] = {{{keywords}, nullptr}};
-                    if(! PyArg_ParseTupleAndKeywords(args, kw, "{fmt}",
-                                                     (char**)keywords, {objs}))
-                        return nullptr;
-                    if({checks})
-                        return to_python({name}({args}));
-                    else {{
-                        return nullptr;
-                    }}
-                }}''')
-        else:
-            keywords = ''
-            wrapper = dedent('''
-                static PyObject *
-                {wname}(PyObject *self, PyObject *args, PyObject *kw)
-                {{
-                    return to_python({name}({args}));
-                }}''')
-
-        self.wrappers.append(
-            wrapper.format(name=func.fdecl.name,
-                           size=len(ctypes),
-                           fmt="O" * len(ctypes),
-                           objs=', '.join('&args_obj[%d]' % i
-                                          for i in range(len(ctypes))),
-                           args=', '.join(args_unboxing),
-                           checks=' && '.join(args_checks),
-                           wname=wrapper_name,
-                           keywords=keywords,
-                           )
-        )
-
-        func_descriptor = wrapper_name, ctypes, signature
+        keywords = [arg.name for arg in func.fdecl.arg_decls[:len(ctypes)]]
+
+        wrapper = dict(name=func.fdecl.name,
+                       args=', '.join(args_unboxing),
+                       checks=' && '.join(args_checks),
+                       wname=wrapper_name,
+                       aname=accepts_name)
+        self.wrappers.append(self.wrapper_code.format(linkage='static',
+                                                      **wrapper))
+        self.exported.setdefault(name, []).append((func, wrapper))
+
+        func_descriptor = (wrapper_name, accepts_name, keywords, ctypes,
+                           signature)
         self.functions.setdefault(name, []).append(func_descriptor)
 
     def add_global_var(self, name, init):
@@ -548,9 +542,9 @@ class PythonModule(object):
         self.python_implems.append(Assign('static PyObject* ' + name,
                                    'to_python({})'.format(init)))
 
-    def __str__(self):
-        """Generate (i.e. yield) the source code of the
-        module line-by-line.
+    def module_definition(self):
+        """Source code of the overload dispatchers, of the method table and
+        of the module initialisation.
         """
         themethods = []
         theextraobjects = []
@@ -560,15 +554,17 @@ class PythonModule(object):
                 'PyModule_AddObject(theModule, "{0}", {0});'.format(vname))
 
         for fname, overloads in self.functions.items():
-            tryall = []
+            calls = []
+            accepts = []
             candidates = []
-            for overload, ctypes, signature in overloads:
-                try_ = dedent("""
-                    if(PyObject* obj = {name}(self, args, kw))
-                        return obj;
-                    PyErr_Clear();
-                    """.format(name=overload))
-                tryall.append(try_)
+            # overloads only differ by the type of their arguments, so the
+            # longest list of names holds the names of all of them
+            keywords = []
+            for overload, accept, names, ctypes, signature in overloads:
+                calls.append(overload)
+                accepts.append(accept)
+                if len(names) > len(keywords):
+                    keywords = names
                 thecall = "{}({})".format(fname,
                                           ",".join(pytype_to_pretty_type(t)
                                                    for t in signature))
@@ -576,19 +572,42 @@ class PythonModule(object):
 
             wrapper_name = pythran_ward + 'wrapall_' + fname
 
+            # arguments are read from the call once, and the overload
+            # accepting them is looked up in a table indexed by their types
             candidate = dedent('''
             static PyObject *
-            {wname}(PyObject *self, PyObject *args, PyObject *kw)
+            {wname}(PyObject *self, PYTHRAN_CALL_PARAMETERS)
             {{
-                return pythonic::handle_python_exception([self, args, kw]()
+                static char const* keywords[] = {{{keywords}nullptr}};
+                static pythonic::python::dispatch_table::accepts_type const
+                    accepts[] = {{{accepts}}};
+                static PyObject* (*const calls[])(PyObject* const*) = {{
+                    {calls}}};
+                static pythonic::python::dispatch_table table;
+                return pythonic::handle_python_exception([=]()
                 -> PyObject* {{
-                {tryall}
+                PyObject* buffer[{size}];
+                PyObject* const* args_obj;
+                Py_ssize_t argc = pythonic::python::unpack_arguments(
+                    PYTHRAN_CALL_ARGUMENTS, keywords, buffer, {nkeywords},
+                    args_obj);
+                long which = argc < 0 ? -1 : table.find(args_obj, argc,
+                                                        accepts, {count});
+                if(which >= 0)
+                    return pythonic::python::check_result(
+                        calls[which](args_obj));
                 return pythonic::python::raise_invalid_argument(
-                               "{name}", "{candidates}", args, kw);
+                               "{name}", "{candidates}",
+                               PYTHRAN_CALL_ARGUMENTS);
                 }});
             }}
             '''.format(name=fname,
-                       tryall="\n".join(tryall),
+                       keywords="".join('"{}", '.format(k) for k in keywords),
+                       accepts=", ".join(accepts),
+                       calls=", ".join(calls),
+                       size=max(len(keywords), 1),
+                       nkeywords=len(keywords),
+                       count=len(overloads),
                        candidates="\\n".join("   " + c for c in candidates),
                        wname=wrapper_name))
 
@@ -596,7 +615,7 @@ class PythonModule(object):
             themethod = dedent('''{{
                 "{name}",
                 (PyCFunction){wname},
-                METH_VARARGS | METH_KEYWORDS,
+                PYTHRAN_METH_CALL,
                 {doc}}}'''.format(name=fname,
                                   wname=wrapper_name,
                                   doc=fdoc))
@@ -676,16 +695,81 @@ class PythonModule(object):
                        extraobjects='\n'.join(theextraobjects),
                        **self.metadata))
 
+        return [Line(code) for code in theoverloads + [methods, module]]
+
+    def __str__(self):
+        """Generate (i.e. yield) the source code of the
+        module line-by-line.
+        """
         body = (self.preamble +
                 self.includes +
                 self.implems +
                 [Line('#ifdef ENABLE_PYTHON_MODULE')] +
                 self.python_implems +
-                [Line(code) for code in self.wrappers + theoverloads] +
-                [Line(methods), Line(module), Line('#endif')])
+                [Line(code) for code in self.wrappers] +
+                self.module_definition() +
+                [Line('#endif')])
 
         return "\n".join(Module(body).generate())
 
+    def split(self, count):
+        """Source code of the module split into at most *count* translation
+        units, to be compiled concurrently.
+
+        The exported functions are spread over all the units but the first
+        one, balancing their number of signatures, and the first unit holds
+        the module definition. Each unit has its own copy of the translated
+        code, which only has internal linkage, while the state of the runtime
+        is defined by the first unit and shared with the others.
+        """
+        if count < 2 or not self.exported:
+            return [str(self)]
+
+        # sorted, so that the same module is always split the same way
+        names = sorted(self.exported,
+                       key=lambda name: (-len(self.exported[name]), name))
+        groups = [[] for _ in range(min(count - 1, len(names)))]
+        for name in names:
+            group = min(groups, key=lambda group: sum(map(len, group)))
+            group.append(self.exported[name])
+
+        exported = [func for name in names
+                    for func, _ in self.exported[name]]
+        global_vars = [stmt for stmt in self.python_implems
+                       if not any(stmt is func for func in exported)]
+        declarations = [Line(self.wrapper_declaration.format(**wrapper))
+                        for name in names
+                        for _, wrapper in self.exported[name]]
+
+        # the numpy API table is filled by the first unit only; the
+        # definitions specific to each unit follow the shared preamble
+        preamble = self.preamble + [Define("PY_ARRAY_UNIQUE_SYMBOL",
+                                           "PYTHRAN_ARRAY_API")]
+        units = [preamble +
+                 self.includes +
+                 self.implems +
+                 [Line('#ifdef ENABLE_PYTHON_MODULE')] +
+                 global_vars +
+                 declarations +
+                 self.module_definition() +
+                 [Line('#endif')]]
+        for group in groups:
+            overloads = [overload for overloads in group
+                         for overload in overloads]
+            units.append(
+                preamble +
+                [Define("NO_IMPORT_ARRAY", "1"),
+                 Define("PYTHRAN_EXTERN_UNIT_STATE", "1")] +
+                self.includes +
+                [Line('#ifdef ENABLE_PYTHON_MODULE')] +
+                [func for func, _ in overloads] +
+                [Line(self.wrapper_code.format(linkage='PYTHRAN_UNIT_LINKAGE',
+                                               **wrapper))
+                 for _, wrapper in overloads] +
+                [Line('#endif')])
+
+        return ["\n".join(Module(body).generate()) for body in units]
+
 
 class CompilationUnit(object):
 
@@ -18,6 +18,7 @@ from .comprehension_patterns import ComprehensionPatterns
 from .list_comp_to_genexp import ListCompToGenexp
 from .loop_full_unrolling import LoopFullUnrolling
 from .modindex import ModIndex
+from .parallel_map import ParallelMap
 from .pattern_transform import PatternTransform
 from .range_loop_unfolding import RangeLoopUnfolding
 from .range_based_simplify import RangeBasedSimplify
@@ -0,0 +1,44 @@
+""" ParallelMap turns maps of pure functions into parallel maps. """
+
+from pythran.analyses import ParallelMaps
+from pythran.passmanager import Transformation
+
+import gast as ast
+
+
+class ParallelMap(Transformation):
+
+    """
+    Replaces map of pure functions by __builtin__.pythran.parallel_map.
+
+    The result is allocated once and filled in place, by several threads when
+    OpenMP is enabled. List comprehensions are turned into maps beforehand, so
+    they benefit from it too.
+
+    >>> import gast as ast
+    >>> from pythran import passmanager, backend
+    >>> node = ast.parse("def foo(x): return x * x\\n"
+    ...                  "def bar(l): return __builtin__.map(foo, l)")
+    >>> pm = passmanager.PassManager("test")
+    >>> _, node = pm.apply(ParallelMap, node)
+    >>> print pm.dump(backend.Python, node)
+    def foo(x):
+        return (x * x)
+    def bar(l):
+        return __builtin__.pythran.parallel_map(foo, l)
+    """
+
+    def __init__(self):
+        Transformation.__init__(self, ParallelMaps)
+
+    def visit_Call(self, node):
+        self.generic_visit(node)
+        if node in self.parallel_maps:
+            self.update = True
+            node.func = ast.Attribute(
+                value=ast.Attribute(value=ast.Name(id='__builtin__',
+                                                   ctx=ast.Load(),
+                                                   annotation=None),
+                                    attr="pythran", ctx=ast.Load()),
+                attr="parallel_map", ctx=ast.Load())
+        return node
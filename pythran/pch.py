@@ -0,0 +1,140 @@
+'''
+This module contains the precompiled header of the pythonic headers every
+generated module starts with
+    * bundle: headers of the precompiled header
+    * precompiled_header: build or reuse the precompiled header of C++ files
+'''
+
+from pythran.cache import cache_dir, evict, _compile_command, _compiler_id
+from pythran.cache import _headers_digest
+from pythran.config import cfg
+
+import hashlib
+import logging
+import os
+import shutil
+import subprocess
+import time
+
+logger = logging.getLogger('pythran')
+
+# included first by every generated module, see generate_cxx
+bundle = ("pythonic/core.hpp",
+          "pythonic/python/core.hpp",
+          "pythonic/types/bool.hpp",
+          "pythonic/types/int.hpp")
+
+# seconds after which the build of a precompiled header that did not finish
+# is considered abandoned
+stale_lock_delay = 10 * 60
+
+
+def _bundle_header(cxxfile):
+    '''
+    Header made of the macro definitions and of the bundle `cxxfile` starts
+    with, None if it does not start with the bundle.
+    '''
+    with open(cxxfile) as fd:
+        lines = fd.read().splitlines(True)
+    start = 0
+    while start < len(lines) and lines[start].startswith(('#define ',
+                                                          '#undef ')):
+        start += 1
+    stop = start + len(bundle)
+    if [line.rstrip() for line in lines[start:stop]] != \
+            ['#include <{}>'.format(header) for header in bundle]:
+        return None
+    return ''.join(lines[:stop])
+
+
+def _remove_stale_lock(path, precompiled):
+    '''
+    Remove the lock `path` of the build of `precompiled` if that build was
+    abandoned, that is if `precompiled` is missing and `path` was not
+    updated for `stale_lock_delay` seconds.
+    '''
+    try:
+        if time.time() - os.stat(path).st_mtime < stale_lock_delay:
+            return
+    except OSError:
+        # released meanwhile
+        return
+    if not os.path.exists(precompiled):
+        logger.info("Removing stale precompiled header: " + path)
+        shutil.rmtree(path, ignore_errors=True)
+
+
+def precompiled_header(cxxfiles, extension_args):
+    '''
+    Path of the header to include first when compiling each of `cxxfiles`
+    with the distutils extension arguments `extension_args`, so that the
+    compiler loads its precompiled form instead of parsing the bundle again.
+
+    Precompiled headers are kept in the cache, keyed by the macros defined
+    before the bundle, the compiler and its flags. None if the cache is
+    disabled, if the files do not all start with the same macros and the
+    bundle or if the compilation of the precompiled header fails.
+    '''
+    directory = cache_dir()
+    if directory is None:
+        return None
+    if not cfg.getboolean('pythran', 'precompiled_header'):
+        return None
+    # the header replaces the start of every file
+    contents = set(_bundle_header(cxxfile) for cxxfile in cxxfiles)
+    if len(contents) != 1:
+        return None
+    content, = contents
+    if content is None:
+        return None
+
+    command = _compile_command(extension_args)
+    if command is None:
+        return None
+    digest = hashlib.sha256(content.encode('utf-8'))
+    digest.update(b'\0' + repr(command).encode('utf-8'))
+    digest.update(_compiler_id())
+    digest.update(_headers_digest())
+    path = os.path.join(directory, 'pch-' + digest.hexdigest())
+    header = os.path.join(path, 'pythonic.hpp')
+    # clang looks for `header.pch', gcc for `header.gch'
+    precompiled = header + ('.pch' if b'clang' in _compiler_id() else '.gch')
+
+    if os.path.exists(precompiled):
+        try:
+            # the modification time of the directory tracks the last use, for
+            # the eviction; the header is left untouched as compilers check it
+            os.utime(path, None)
+            return header
+        except OSError:
+            # evicted meanwhile
+            return None
+
+    try:
+        if not os.path.isdir(directory):
+            os.makedirs(directory)
+        _remove_stale_lock(path, precompiled)
+        # the directory is the lock of the build
+        os.mkdir(path)
+    except (IOError, OSError):
+        # being built concurrently, or no cache
+        return None
+    try:
+        with open(header, 'w') as fd:
+            fd.write(content)
+        logger.info("Precompiling headers: " + precompiled)
+        # build then rename, so that concurrent compilations never see a
+        # partial precompiled header
+        subprocess.check_output(command + ['-x', 'c++-header', header,
+                                           '-o', precompiled + '.tmp'],
+                                stderr=subprocess.STDOUT)
+        os.rename(precompiled + '.tmp', precompiled)
+    except (IOError, OSError, subprocess.CalledProcessError) as e:
+        logger.warn("Cannot precompile headers: " + str(e))
+        return None
+    finally:
+        # releases the lock of a failed or interrupted build
+        if not os.path.exists(precompiled):
+            shutil.rmtree(path, ignore_errors=True)
+    evict(directory, cfg.getint('pythran', 'cache_size') * 2 ** 20)
+    return header
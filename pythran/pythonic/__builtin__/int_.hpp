@@ -20,7 +20,9 @@ namespace __builtin__
     }
     int_::type int_::operator()(types::str const &t, int base) const
     {
-      return (*this)(t.c_str(), base);
+      // a short copy, rather than turning a view into a string of its own
+      std::string tmp(t.chars(), t.size());
+      return (*this)(tmp.c_str(), base);
     }
 
     template <class T>
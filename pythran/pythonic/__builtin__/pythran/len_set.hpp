@@ -4,8 +4,7 @@
 #include "pythonic/include/__builtin__/pythran/len_set.hpp"
 
 #include "pythonic/utils/functor.hpp"
-
-#include <set>
+#include "pythonic/utils/flat_hash_set.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -18,8 +17,9 @@ namespace __builtin__
     template <class Iterable>
     long len_set(Iterable const &s)
     {
-      return std::set<typename Iterable::iterator::value_type>(s.begin(),
-                                                               s.end()).size();
+      return utils::flat_hash_set<typename std::remove_cv<
+          typename Iterable::iterator::value_type>::type>(s.begin(), s.end())
+          .size();
     }
 
     DEFINE_FUNCTOR(pythonic::__builtin__::pythran, len_set);
@@ -0,0 +1,129 @@
+#ifndef PYTHONIC_BUILTIN_PYTHRAN_PARALLEL_MAP_HPP
+#define PYTHONIC_BUILTIN_PYTHRAN_PARALLEL_MAP_HPP
+
+#include "pythonic/include/__builtin__/pythran/parallel_map.hpp"
+
+#include "pythonic/__builtin__/map.hpp"
+#include "pythonic/types/list.hpp"
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/openmp.hpp"
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+PYTHONIC_NS_BEGIN
+
+namespace __builtin__
+{
+
+  namespace pythran
+  {
+
+    namespace details
+    {
+      template <class Iterator>
+      auto random_access(Iterator const &it, int)
+          -> decltype(*(it + 1L), it - it, std::true_type());
+
+      template <class Iterator>
+      std::false_type random_access(Iterator const &, ...);
+
+      template <class... Iterators>
+      struct all_random_access;
+
+      template <>
+      struct all_random_access<> : std::true_type {
+      };
+
+      template <class Iterator, class... Iterators>
+      struct all_random_access<Iterator, Iterators...>
+          : std::integral_constant<
+                bool,
+                decltype(random_access(std::declval<Iterator>(), 0))::value &&
+                    all_random_access<Iterators...>::value> {
+      };
+
+#ifdef _OPENMP
+      // fill ``out'' with op(*(iterators + i)...) for i in [0, n)
+      template <class Out, class Operator, class... Iterators>
+      void parallel_fill(Out &out, Operator &op, long n,
+                         Iterators... iterators)
+      {
+        // exceptions cannot leave the parallel region, the one of the
+        // first failing item is raised afterward, as a sequential map
+        // would raise it
+        long failed = n;
+        std::exception_ptr error;
+#pragma omp parallel for
+        for (long i = 0; i < n; ++i) {
+          try {
+            out.fast(i) = op(*(iterators + i)...);
+          } catch (...) {
+#pragma omp critical
+            if (i < failed) {
+              failed = i;
+              error = std::current_exception();
+            }
+          }
+        }
+        if (error)
+          std::rethrow_exception(error);
+      }
+#endif
+
+      template <typename Operator, typename List0, typename... ListN>
+      auto parallel_map(std::true_type, Operator &op, List0 &&seq,
+                        ListN &&... lists)
+          -> decltype(__builtin__::map(op, std::forward<List0>(seq),
+                                       std::forward<ListN>(lists)...))
+      {
+#ifdef _OPENMP
+        long const n = seq.end() - seq.begin();
+        if (n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT && !omp_in_parallel()) {
+          decltype(__builtin__::map(op, std::forward<List0>(seq),
+                                    std::forward<ListN>(lists)...)) out(n);
+          parallel_fill(out, op, n, seq.begin(), lists.begin()...);
+          return out;
+        }
+#endif
+        return __builtin__::map(op, std::forward<List0>(seq),
+                                std::forward<ListN>(lists)...);
+      }
+
+      template <typename Operator, typename List0, typename... ListN>
+      auto parallel_map(std::false_type, Operator &op, List0 &&seq,
+                        ListN &&... lists)
+          -> decltype(__builtin__::map(op, std::forward<List0>(seq),
+                                       std::forward<ListN>(lists)...))
+      {
+        return __builtin__::map(op, std::forward<List0>(seq),
+                                std::forward<ListN>(lists)...);
+      }
+    }
+
+    template <typename Operator, typename List0, typename... ListN>
+    auto parallel_map(Operator op, List0 &&seq, ListN &&... lists)
+        -> decltype(__builtin__::map(op, std::forward<List0>(seq),
+                                     std::forward<ListN>(lists)...))
+    {
+      using result_type = decltype(__builtin__::map(
+          op, std::forward<List0>(seq), std::forward<ListN>(lists)...));
+      // items are assigned in place, so they must be default constructible
+      using random_access =
+          details::all_random_access<decltype(seq.begin()),
+                                     decltype(lists.begin())...>;
+      using in_place = std::integral_constant<
+          bool, random_access::value &&
+                    std::is_default_constructible<
+                        typename result_type::value_type>::value>;
+      return details::parallel_map(in_place(), op, std::forward<List0>(seq),
+                                   std::forward<ListN>(lists)...);
+    }
+
+    DEFINE_FUNCTOR(pythonic::__builtin__::pythran, parallel_map);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -5,6 +5,7 @@
 
 #include "pythonic/types/str.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/str_search.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -19,10 +20,10 @@ namespace __builtin__
       if (s.empty())
         return s;
       else {
-        types::str copy = s;
-        copy[0] = ::toupper(s[0]);
-        std::transform(s.begin() + 1, s.end(), copy.begin() + 1, ::tolower);
-        return copy;
+        std::string copy(s.size(), 0);
+        utils::to_upper(&copy[0], s.chars(), 1);
+        utils::to_lower(&copy[1], s.chars() + 1, s.size() - 1);
+        return {std::move(copy)};
       }
     }
 
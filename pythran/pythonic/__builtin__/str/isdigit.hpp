@@ -5,6 +5,7 @@
 
 #include "pythonic/types/str.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/str_search.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -16,8 +17,7 @@ namespace __builtin__
 
     bool isdigit(types::str const &s)
     {
-      return !s.empty() &&
-             std::all_of(s.begin(), s.end(), (int (*)(int))std::isdigit);
+      return !s.empty() && utils::all_digits(s.chars(), s.size());
     }
 
     DEFINE_FUNCTOR(pythonic::__builtin__::str, isdigit);
@@ -5,6 +5,7 @@
 
 #include "pythonic/types/str.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/str_search.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -16,9 +17,9 @@ namespace __builtin__
 
     types::str lower(types::str const &s)
     {
-      types::str copy = s;
-      std::transform(s.begin(), s.end(), copy.begin(), ::tolower);
-      return copy;
+      std::string copy(s.size(), 0);
+      utils::to_lower(&copy[0], s.chars(), s.size());
+      return {std::move(copy)};
     }
 
     DEFINE_FUNCTOR(pythonic::__builtin__::str, lower);
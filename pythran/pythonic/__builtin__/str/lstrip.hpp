@@ -16,7 +16,11 @@ namespace __builtin__
 
     types::str lstrip(types::str const &self, types::str const &to_del)
     {
-      return {self.begin() + self.find_first_not_of(to_del), self.end()};
+      auto first = self.find_first_not_of(to_del);
+      if (first == -1)
+        return types::str();
+      else
+        return self.substr(first);
     }
 
     DEFINE_FUNCTOR(pythonic::__builtin__::str, lstrip);
@@ -17,34 +17,30 @@ namespace __builtin__
     types::str replace(types::str const &self, types::str const &old_pattern,
                        types::str const &new_pattern, long count)
     {
-      char const *needle = old_pattern.c_str();
-      char const *new_needle = new_pattern.c_str();
-      char const *new_needle_end = new_needle + new_pattern.size();
-      char const *haystack = self.c_str();
-
-      char const *haystack_next = strstr(haystack, needle);
-      if (!count || !haystack_next) {
-        return {haystack};
-      } else {
-        size_t n =
-            1 + std::max(self.size(), self.size() * (1 + new_pattern.size()) /
-                                          (1 + old_pattern.size()));
-        char *buffer = new char[n];
-        char *iter = buffer;
-        do {
-          iter = std::copy(haystack, haystack_next, iter);
-          iter = std::copy(new_needle, new_needle_end, iter);
-          --count;
-          haystack = haystack_next + old_pattern.size();
-          assert(size_t(iter - buffer) < n);
-        } while (count && (haystack_next = strstr(haystack, needle)));
-
-        std::copy(haystack, self.c_str() + self.size() + 1, iter);
-
-        types::str replaced(buffer);
-        delete[] buffer;
-        return replaced;
-      }
+      long next = self.find(old_pattern);
+      if (!count || next == -1)
+        return self;
+
+      std::string replaced;
+      replaced.reserve(
+          std::max(self.size(), self.size() * (1 + new_pattern.size()) /
+                                    (1 + old_pattern.size())));
+      long current = 0;
+      // an empty pattern matches once before each character and at the end
+      long const step = old_pattern.empty() ? 1 : 0;
+      do {
+        replaced.append(self.chars() + current, next - current);
+        replaced.append(new_pattern.chars(), new_pattern.size());
+        --count;
+        current = next + old_pattern.size();
+        if (step && current < self.size())
+          replaced += self[current];
+        current += step;
+      } while (count && current <= self.size() &&
+               (next = self.find(old_pattern, current)) != -1);
+      if (current < self.size())
+        replaced.append(self.chars() + current, self.size() - current);
+      return {std::move(replaced)};
     }
 
     DEFINE_FUNCTOR(pythonic::__builtin__::str, replace);
@@ -16,7 +16,7 @@ namespace __builtin__
 
     types::str rstrip(types::str const &self, types::str const &to_del)
     {
-      return {self.begin(), self.begin() + self.find_last_not_of(to_del) + 1};
+      return self.substr(0, self.find_last_not_of(to_del) + 1);
     }
 
     DEFINE_FUNCTOR(pythonic::__builtin__::str, rstrip);
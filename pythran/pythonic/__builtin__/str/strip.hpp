@@ -15,14 +15,11 @@ namespace __builtin__
   {
     types::str strip(types::str const &self, types::str const &to_del)
     {
-      if (!self)
-        return self;
       auto first = self.find_first_not_of(to_del);
       if (first == -1)
         return types::str();
       else
-        return types::str(self.begin() + first,
-                          self.begin() + self.find_last_not_of(to_del) + 1);
+        return self.substr(first, self.find_last_not_of(to_del) + 1 - first);
     }
 
     DEFINE_FUNCTOR(pythonic::__builtin__::str, strip);
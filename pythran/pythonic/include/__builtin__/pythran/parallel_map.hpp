@@ -0,0 +1,34 @@
+#ifndef PYTHONIC_INCLUDE_BUILTIN_PYTHRAN_PARALLEL_MAP_HPP
+#define PYTHONIC_INCLUDE_BUILTIN_PYTHRAN_PARALLEL_MAP_HPP
+
+#include "pythonic/include/__builtin__/map.hpp"
+#include "pythonic/include/utils/functor.hpp"
+
+#include <utility>
+
+PYTHONIC_NS_BEGIN
+
+namespace __builtin__
+{
+
+  namespace pythran
+  {
+
+    /* map(op, seq, lists...) for an ``op'' without side effect
+     *
+     * When the sequences have random access iterators, the result is
+     * allocated at once and filled in place, by several threads if OpenMP
+     * is enabled and there are at least PYTHRAN_OPENMP_MIN_ITERATION_COUNT
+     * items. Other sequences go through map.
+     */
+    template <typename Operator, typename List0, typename... ListN>
+    auto parallel_map(Operator op, List0 &&seq, ListN &&... lists)
+        -> decltype(__builtin__::map(op, std::forward<List0>(seq),
+                                     std::forward<ListN>(lists)...));
+
+    DECLARE_FUNCTOR(pythonic::__builtin__::pythran, parallel_map);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_ARGPARTITION_HPP
+#define PYTHONIC_INCLUDE_NUMPY_ARGPARTITION_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/NoneType.hpp"
+#include "pythonic/include/numpy/partition.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class T, size_t N, class K>
+  types::ndarray<long, N> argpartition(types::ndarray<T, N> const &a,
+                                       K const &kth, long axis = -1);
+
+  template <class T, size_t N, class K>
+  types::ndarray<long, 1> argpartition(types::ndarray<T, N> const &a,
+                                       K const &kth, types::none_type axis);
+
+  NUMPY_EXPR_TO_NDARRAY0_DECL(argpartition);
+
+  DECLARE_FUNCTOR(pythonic::numpy, argpartition);
+}
+PYTHONIC_NS_END
+
+#endif
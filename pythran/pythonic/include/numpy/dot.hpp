@@ -5,6 +5,7 @@
 #include "pythonic/include/numpy/sum.hpp"
 #include "pythonic/include/types/numpy_expr.hpp"
 #include "pythonic/include/types/traits.hpp"
+#include "pythonic/include/utils/gemm.hpp"
 
 template <class T>
 struct is_blas_type : pythonic::types::is_complex<T> {
@@ -82,8 +83,8 @@ namespace numpy
           1>>::type
   dot(E const &e, F const &f);
 
-  // If one of the arg doesn't have a "blas compatible type", we use a slow
-  // matrix vector multiplication.
+  // If one of the arg doesn't have a "blas compatible type", we use our own
+  // packed matrix vector multiplication.
   template <class E, class F>
   typename std::enable_if<
       (!is_blas_type<typename E::dtype>::value ||
@@ -94,8 +95,8 @@ namespace numpy
           1>>::type
   dot(E const &e, F const &f);
 
-  // If one of the arg doesn't have a "blas compatible type", we use a slow
-  // matrix vector multiplication.
+  // If one of the arg doesn't have a "blas compatible type", we use our own
+  // packed matrix vector multiplication.
   template <class E, class F>
   typename std::enable_if<
       (!is_blas_type<typename E::dtype>::value ||
@@ -138,8 +139,8 @@ namespace numpy
           2>>::type
   dot(E const &e, F const &f);
 
-  // If one of the arg doesn't have a "blas compatible type", we use a slow
-  // matrix multiplication.
+  // If one of the arg doesn't have a "blas compatible type", we use our own
+  // packed matrix multiplication.
   template <class E, class F>
   typename std::enable_if<
       (!is_blas_type<typename E::dtype>::value ||
@@ -0,0 +1,36 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_FROMFILE_HPP
+#define PYTHONIC_INCLUDE_NUMPY_FROMFILE_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/numpy/float64.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/file.hpp"
+#include "pythonic/include/types/str.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  /* Binary data is read straight into the buffer of the array when given a
+   * file name, and through the buffer of the file otherwise.
+   */
+  template <class dtype = functor::float64>
+  types::ndarray<typename dtype::type, 1>
+  fromfile(types::str const &file, dtype d = dtype(), long count = -1,
+           types::str const &sep = "");
+
+  template <class dtype = functor::float64>
+  types::ndarray<typename dtype::type, 1>
+  fromfile(types::file &file, dtype d = dtype(), long count = -1,
+           types::str const &sep = "");
+
+  template <class dtype = functor::float64>
+  types::ndarray<typename dtype::type, 1>
+  fromfile(types::file &&file, dtype d = dtype(), long count = -1,
+           types::str const &sep = "");
+
+  DECLARE_FUNCTOR(pythonic::numpy, fromfile);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -3,18 +3,41 @@
 
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/NoneType.hpp"
 #include "pythonic/include/numpy/asarray.hpp"
+#include "pythonic/include/numpy/partition.hpp"
 #include <algorithm>
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
+  namespace details
+  {
+    template <class T>
+    using median_type = decltype(std::declval<T>() + 1.);
+
+    template <class T, size_t N>
+    using median_axis_type =
+        typename std::conditional<N == 1, median_type<T>,
+                                  types::ndarray<median_type<T>, N - 1>>::type;
+  }
+
+  template <class T, size_t N>
+  details::median_type<T> median(types::ndarray<T, N> const &arr,
+                                 types::none_type axis = types::none_type());
+
+  template <class T, size_t N>
+  details::median_type<T> median(types::ndarray<T, N> &&arr,
+                                 types::none_type axis = types::none_type());
+
   template <class T, size_t N>
-  decltype(std::declval<T>() + 1.) median(types::ndarray<T, N> const &arr);
+  details::median_axis_type<T, N> median(types::ndarray<T, N> const &arr,
+                                         long axis);
 
   template <class T, size_t N>
-  decltype(std::declval<T>() + 1.) median(types::ndarray<T, N> &&arr);
+  details::median_axis_type<T, N> median(types::ndarray<T, N> &&arr,
+                                         long axis);
 
   NUMPY_EXPR_TO_NDARRAY0_DECL(median);
 
@@ -0,0 +1,42 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_MEMMAP_HPP
+#define PYTHONIC_INCLUDE_NUMPY_MEMMAP_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/numpy/uint8.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/NoneType.hpp"
+#include "pythonic/include/types/str.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  /* The buffer of the array is the mapping itself, released with the last
+   * array using it.
+   *
+   * Mode ``r+'' writes back to the file. Mode ``c'' maps the file
+   * privately, changes to the array being left in memory. Mode ``r'' maps
+   * it read only: the array must not be written to, and is flagged as such
+   * when returned to Python.
+   */
+  template <class dtype = functor::uint8>
+  types::ndarray<typename dtype::type, 1>
+  memmap(types::str const &filename, dtype d = dtype(),
+         types::str const &mode = "r+", long offset = 0,
+         types::none_type shape = {});
+
+  template <class dtype>
+  types::ndarray<typename dtype::type, 1>
+  memmap(types::str const &filename, dtype d, types::str const &mode,
+         long offset, long shape);
+
+  template <class dtype, class IntTy, size_t N>
+  types::ndarray<typename dtype::type, N>
+  memmap(types::str const &filename, dtype d, types::str const &mode,
+         long offset, types::array<IntTy, N> const &shape);
+
+  DECLARE_FUNCTOR(pythonic::numpy, memmap);
+}
+PYTHONIC_NS_END
+
+#endif
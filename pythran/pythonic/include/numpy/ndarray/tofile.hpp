@@ -0,0 +1,40 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_NDARRAY_TOFILE_HPP
+#define PYTHONIC_INCLUDE_NUMPY_NDARRAY_TOFILE_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/numpy_conversion.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/file.hpp"
+#include "pythonic/include/types/str.hpp"
+#include "pythonic/include/__builtin__/None.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+
+  namespace ndarray
+  {
+    /* Binary data is written straight from the buffer of the array when
+     * given a file name, and through the buffer of the file otherwise.
+     */
+    template <class T, size_t N>
+    types::none_type tofile(types::ndarray<T, N> const &expr,
+                            types::str const &file,
+                            types::str const &sep = "");
+
+    template <class T, size_t N>
+    types::none_type tofile(types::ndarray<T, N> const &expr,
+                            types::file &file, types::str const &sep = "");
+
+    template <class T, size_t N>
+    types::none_type tofile(types::ndarray<T, N> const &expr,
+                            types::file &&file, types::str const &sep = "");
+
+    NUMPY_EXPR_TO_NDARRAY0_DECL(tofile);
+    DECLARE_FUNCTOR(pythonic::numpy::ndarray, tofile);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -2,6 +2,7 @@
 #define PYTHONIC_INCLUDE_NUMPY_PARTIAL_SUM_HPP
 
 #include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/utils/prefix_scan.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -24,8 +25,6 @@ namespace numpy
 
   template <class Op, class E, class dtype = result_dtype<Op, E>>
   using partial_sum_type = types::ndarray<typename dtype::type, E::value>;
-  template <class Op, class E, class dtype = result_dtype<Op, E>>
-  using partial_sum_type2 = types::ndarray<typename dtype::type, E::value - 1>;
 
   template <class Op, class E, class dtype = result_dtype<Op, E>>
   typename std::enable_if<E::value != 1, partial_sum_type<Op, E, dtype>>::type
@@ -0,0 +1,47 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_PARTITION_HPP
+#define PYTHONIC_INCLUDE_NUMPY_PARTITION_HPP
+
+#include <vector>
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/NoneType.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    long normalize_axis(long axis, size_t N);
+
+    template <class K>
+    typename std::enable_if<std::is_integral<K>::value,
+                            std::vector<long>>::type
+    normalize_kth(K kth, long n);
+
+    template <class K>
+    typename std::enable_if<!std::is_integral<K>::value,
+                            std::vector<long>>::type
+    normalize_kth(K const &kth, long n);
+  }
+
+  template <class T, size_t N, class K>
+  types::ndarray<T, N> partition(types::ndarray<T, N> const &a, K const &kth,
+                                 long axis = -1);
+
+  template <class T, size_t N, class K>
+  types::ndarray<T, N> partition(types::ndarray<T, N> &&a, K const &kth,
+                                 long axis = -1);
+
+  template <class T, size_t N, class K>
+  types::ndarray<T, 1> partition(types::ndarray<T, N> const &a, K const &kth,
+                                 types::none_type axis);
+
+  NUMPY_EXPR_TO_NDARRAY0_DECL(partition);
+
+  DECLARE_FUNCTOR(pythonic::numpy, partition);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_PERCENTILE_HPP
+#define PYTHONIC_INCLUDE_NUMPY_PERCENTILE_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/NoneType.hpp"
+#include "pythonic/include/numpy/quantile.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class T, size_t N, class Q, class Axis = types::none_type>
+  typename details::quantile_result<T, N, Q, Axis>::type
+  percentile(types::ndarray<T, N> const &a, Q const &q, Axis axis = Axis());
+
+  template <class T, size_t N, class Q, class Axis = types::none_type>
+  typename details::quantile_result<T, N, Q, Axis>::type
+  percentile(types::ndarray<T, N> &&a, Q const &q, Axis axis = Axis());
+
+  NUMPY_EXPR_TO_NDARRAY0_DECL(percentile);
+
+  DECLARE_FUNCTOR(pythonic::numpy, percentile);
+}
+PYTHONIC_NS_END
+
+#endif
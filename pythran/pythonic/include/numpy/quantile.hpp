@@ -0,0 +1,45 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_QUANTILE_HPP
+#define PYTHONIC_INCLUDE_NUMPY_QUANTILE_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/NoneType.hpp"
+#include "pythonic/include/numpy/median.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    /* A scalar ``q'' yields a scalar, or an array of the shape of ``a''
+     * without ``axis''. A sequence of ``q'' adds a leading dimension.
+     */
+    template <class T, size_t N, class Q, class Axis>
+    struct quantile_result {
+      using R = median_type<T>;
+      static const size_t M =
+          std::is_same<Axis, types::none_type>::value ? 1 : N;
+      using type = typename std::conditional<
+          std::is_arithmetic<Q>::value,
+          typename std::conditional<M == 1, R,
+                                    types::ndarray<R, M - 1>>::type,
+          types::ndarray<R, M>>::type;
+    };
+  }
+
+  template <class T, size_t N, class Q, class Axis = types::none_type>
+  typename details::quantile_result<T, N, Q, Axis>::type
+  quantile(types::ndarray<T, N> const &a, Q const &q, Axis axis = Axis());
+
+  template <class T, size_t N, class Q, class Axis = types::none_type>
+  typename details::quantile_result<T, N, Q, Axis>::type
+  quantile(types::ndarray<T, N> &&a, Q const &q, Axis axis = Axis());
+
+  NUMPY_EXPR_TO_NDARRAY0_DECL(quantile);
+
+  DECLARE_FUNCTOR(pythonic::numpy, quantile);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -1,8 +1,28 @@
 #ifndef PYTHONIC_INCLUDE_NUMPY_RANDOM_GENERATOR_HPP
 #define PYTHONIC_INCLUDE_NUMPY_RANDOM_GENERATOR_HPP
 
+#include "pythonic/include/utils/unit_state.hpp"
+
+#include <atomic>
+#include <cstdint>
 #include <random>
 
+namespace pythonic_shared
+{
+  namespace numpy_random
+  {
+    // key shared by the streams of all threads, and next free stream
+    struct seed_state {
+      uint64_t key;
+      std::atomic<uint64_t> streams;
+      // bumped by each seed, so that threads pick a new stream
+      std::atomic<unsigned long> epoch;
+    };
+
+    extern PYTHRAN_UNIT_LINKAGE seed_state state;
+  }
+}
+
 PYTHONIC_NS_BEGIN
 namespace numpy
 {
@@ -10,12 +30,71 @@ namespace numpy
   {
     namespace details
     {
-      // Found by reading Numpy source code RNG values
-      // in (random/mtrand/randomkit.c),
-      // but the random generator type is ! explicitly mentioned.
-      using default_numpy_generator_t = std::mt19937;
-      std::random_device rd;
-      default_numpy_generator_t generator(rd());
+      /* Philox4x32-10 counter-based generator
+       *
+       * From ``Parallel Random Numbers: As Easy as 1, 2, 3'' (Salmon et al.,
+       * SC'11): each block of four 32 bits words is a keyed bijection of a
+       * 128 bits counter, made of a stream number and of the index of the
+       * block in that stream. Streams are thus independent, and any block
+       * can be computed without the previous ones, which lets bulk draws be
+       * vectorized and split among threads.
+       */
+      class philox_engine
+      {
+      public:
+        using result_type = uint32_t;
+
+        static constexpr result_type min()
+        {
+          return 0;
+        }
+        static constexpr result_type max()
+        {
+          return UINT32_MAX;
+        }
+
+        philox_engine(uint64_t key = 0, uint64_t stream = 0);
+
+        void seed(uint64_t key, uint64_t stream = 0);
+
+        result_type operator()();
+        void discard(unsigned long long z);
+
+        // next ``n'' 64 bits words, starting at the next block
+        void fill(uint64_t *out, long n);
+
+      private:
+        uint64_t key, stream, block;
+        uint32_t words[4];
+        unsigned used;
+      };
+
+      using default_numpy_generator_t = philox_engine;
+
+      using pythonic_shared::numpy_random::seed_state;
+      using pythonic_shared::numpy_random::state;
+
+      // a key from the system entropy source
+      uint64_t random_key();
+      void seed(uint64_t key);
+
+      // the calling thread's generator, for draws of a single value
+      default_numpy_generator_t &generator();
+
+      // ``f(engine, first, count)'' fills chunks of [out, out + n), each
+      // from a fresh stream, in parallel for large ``n''
+      template <class T, class F>
+      void parallel_fill(T *out, long n, F const &f);
+
+      // bulk-fill kernels
+      void fill_uniform(double *out, long n, double low, double high);
+      void fill_normal(double *out, long n, double loc, double scale);
+      void fill_integers(long *out, long n, long low, long high);
+
+      // draws of a single value
+      double uniform(default_numpy_generator_t &engine);
+      double standard_normal(default_numpy_generator_t &engine);
+      long integer(default_numpy_generator_t &engine, long low, long high);
     }
   }
 }
@@ -0,0 +1,33 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_SAVE_HPP
+#define PYTHONIC_INCLUDE_NUMPY_SAVE_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/file.hpp"
+#include "pythonic/include/types/str.hpp"
+#include "pythonic/include/__builtin__/None.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  // ``.npy'' is appended to file names that do not end with it
+  template <class T, size_t N>
+  types::none_type save(types::str const &file,
+                        types::ndarray<T, N> const &arr);
+
+  template <class T, size_t N>
+  types::none_type save(types::file &file, types::ndarray<T, N> const &arr);
+
+  template <class T, size_t N>
+  types::none_type save(types::file &&file, types::ndarray<T, N> const &arr);
+
+  template <class F, class E>
+  typename std::enable_if<!types::is_ndarray<E>::value, types::none_type>::type
+  save(F &&file, E const &expr);
+
+  DECLARE_FUNCTOR(pythonic::numpy, save);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -5,13 +5,15 @@
 
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/str.hpp"
 
 PYTHONIC_NS_BEGIN
 namespace numpy
 {
 
   template <class T, size_t N>
-  types::ndarray<T, N> sort(types::ndarray<T, N> const &expr, long axis = -1);
+  types::ndarray<T, N> sort(types::ndarray<T, N> const &expr, long axis = -1,
+                            types::str const &kind = "quicksort");
 
   NUMPY_EXPR_TO_NDARRAY0_DECL(sort);
   DECLARE_FUNCTOR(pythonic::numpy, sort);
@@ -1,16 +1,19 @@
 #ifndef PYTHONIC_INCLUDE_NUMPY_TAKE_HPP
 #define PYTHONIC_INCLUDE_NUMPY_TAKE_HPP
 
-#include "pythonic/include/types/numpy_fexpr.hpp"
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/numpy/asarray.hpp"
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
   template <class F, class T>
-  auto take(T &&expr, F &&indices)
-      -> decltype(types::numpy_fexpr<T, F>(std::forward<T>(expr),
-                                           std::forward<F>(indices)));
+  types::ndarray<
+      typename types::dtype_of<typename std::decay<T>::type>::type,
+      std::decay<decltype(asarray(std::declval<F>()))>::type::value>
+  take(T &&expr, F &&indices);
 
   DECLARE_FUNCTOR(pythonic::numpy, take);
 }
@@ -2,14 +2,23 @@
 #define PYTHONIC_INCLUDE_RANDOM_RANDOM_HPP
 
 #include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/unit_state.hpp"
 #include <random>
 
+namespace pythonic_shared
+{
+  namespace random
+  {
+    extern PYTHRAN_UNIT_LINKAGE std::mt19937 __random_generator;
+  }
+}
+
 PYTHONIC_NS_BEGIN
 
 namespace random
 {
 
-  static std::mt19937 __random_generator;
+  using pythonic_shared::random::__random_generator;
 
   double random();
 
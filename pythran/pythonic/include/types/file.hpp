@@ -14,6 +14,7 @@
 #include <string>
 #include <cstdio>
 #include <unistd.h>
+#include <sys/stat.h>
 
 PYTHONIC_NS_BEGIN
 
@@ -27,7 +28,8 @@ namespace types
   private:
     file &f;
     types::str curr;
-    int position;
+    // number of lines read so far, -1 at the end of the file
+    long position;
 
   public:
     using value_type = types::str;
@@ -46,6 +48,15 @@ namespace types
 
   struct _file {
     FILE *f;
+    /* Files only opened for reading are read by large chunks, straight from
+     * their descriptor, so that regular files and pipes alike are read with
+     * few system calls. ``buffer'' holds what is left of the last chunk and
+     * the strings returned by reads are views on it, not copies.
+     */
+    bool buffered;
+    types::str buffer;
+    // whether the descriptor reached the end of the file, in buffered mode
+    bool at_eof;
     _file();
     _file(types::str const &filename, types::str const &strmode = "r");
     FILE *operator*() const;
@@ -61,6 +72,13 @@ namespace types
     bool is_open;
     types::str mode, name, newlines;
 
+    // size of the chunks read in buffered mode
+    static const long chunk_size = 1 << 16;
+    // read at most ``n'' characters from the descriptor, 0 at end of file
+    long read_some(char *out, long n);
+    // append a chunk to the buffer, false at end of file
+    bool fill_buffer();
+
   public:
     // Types
     using iterator = file_iterator;
@@ -10,6 +10,8 @@
 #include "pythonic/include/utils/reserve.hpp"
 #include "pythonic/include/utils/int_.hpp"
 #include "pythonic/include/utils/broadcast_copy.hpp"
+#include "pythonic/include/utils/gather_scatter.hpp"
+#include "pythonic/include/utils/stream_compaction.hpp"
 
 #include "pythonic/include/types/slice.hpp"
 #include "pythonic/include/types/tuple.hpp"
@@ -2,6 +2,7 @@
 #define PYTHONIC_INCLUDE_TYPES_NUMPY_FEXPR_HPP
 
 #include "pythonic/include/types/nditerator.hpp"
+#include "pythonic/include/utils/stream_compaction.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -50,14 +51,6 @@ namespace types
     numpy_fexpr(numpy_fexpr &&) = default;
     numpy_fexpr(Arg const &arg, F const &filter);
 
-    template <class FIter, class O>
-    void _copy_mask(FIter fiter, FIter fend, O &out, long &index,
-                    utils::int_<1>);
-
-    template <class FIter, class O, size_t N>
-    void _copy_mask(FIter fiter, FIter fend, O &out, long &index,
-                    utils::int_<N>);
-
     template <class E>
     typename std::enable_if<is_iterable<E>::value, numpy_fexpr &>::type
     operator=(E const &expr);
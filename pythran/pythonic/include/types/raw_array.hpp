@@ -1,6 +1,8 @@
 #ifndef PYTHONIC_INCLUDE_TYPES_RAW_ARRAY_HPP
 #define PYTHONIC_INCLUDE_TYPES_RAW_ARRAY_HPP
 
+#include "pythonic/include/utils/allocate.hpp"
+
 PYTHONIC_NS_BEGIN
 
 namespace types
@@ -8,6 +10,8 @@ namespace types
   enum class ownership {
     external,
     owned,
+    mapped,
+    mapped_read_only,
   };
   /* Wrapper class to store an array pointer
    *
@@ -25,13 +29,23 @@ namespace types
     raw_array();
     raw_array(size_t n);
     raw_array(T *d, ownership o);
+    // mapped memory, released by ``unmap(d, n)''
+    raw_array(T *d, size_t n, ownership o, void (*unmap)(T *, size_t));
     raw_array(raw_array<T> &&d);
     void forget();
+    bool mapped() const;
+    // false for memory mapped read only
+    bool writable() const;
 
     ~raw_array();
 
   private:
-    bool external;
+    ownership owner;
+    /* size of the block from utils::allocate, 0 if obtained from malloc, or
+     * size of the mapping
+     */
+    size_t nbytes;
+    void (*unmap)(T *, size_t);
   };
 }
 PYTHONIC_NS_END
@@ -5,13 +5,13 @@
 #include "pythonic/include/types/empty_iterator.hpp"
 #include "pythonic/include/types/list.hpp"
 
+#include "pythonic/include/utils/flat_hash_set.hpp"
 #include "pythonic/include/utils/iterator.hpp"
 #include "pythonic/include/utils/reserve.hpp"
 #include "pythonic/include/utils/shared_ref.hpp"
 
 #include "pythonic/include/__builtin__/in.hpp"
 
-#include <set>
 #include <memory>
 #include <utility>
 #include <limits>
@@ -122,7 +122,7 @@ namespace types
     // data holder
     using _type =
         typename std::remove_cv<typename std::remove_reference<T>::type>::type;
-    using container_type = std::set<_type>;
+    using container_type = utils::flat_hash_set<_type>;
     utils::shared_ref<container_type> data;
 
   public:
@@ -142,9 +142,6 @@ namespace types
     using allocator_type = typename container_type::allocator_type;
     using pointer = typename container_type::pointer;
     using const_pointer = typename container_type::const_pointer;
-    using reverse_iterator = typename container_type::reverse_iterator;
-    using const_reverse_iterator =
-        typename container_type::const_reverse_iterator;
 
     // constructors
     set();
@@ -161,10 +158,6 @@ namespace types
     const_iterator begin() const;
     iterator end();
     const_iterator end() const;
-    reverse_iterator rbegin();
-    const_reverse_iterator rbegin() const;
-    reverse_iterator rend();
-    const_reverse_iterator rend() const;
 
     // modifiers
     T pop();
@@ -189,9 +182,11 @@ namespace types
 
     template <class U>
     bool isdisjoint(U const &other) const;
+    bool isdisjoint(set<T> const &other) const;
 
     template <class U>
     bool issubset(U const &other) const;
+    bool issubset(set<T> const &other) const;
 
     template <class U>
     bool issuperset(U const &other) const;
@@ -280,6 +275,22 @@ namespace types
 
     template <class U>
     friend std::ostream &operator<<(std::ostream &os, set<U> const &v);
+
+  private:
+    // add the elements of ``other''
+    template <class U>
+    void merge(U const &other);
+    void merge(set<T> const &other);
+
+    // only keep the elements that are in ``other''
+    template <class U>
+    void retain(U const &other);
+    void retain(set<T> const &other);
+
+    // remove the elements of ``other''
+    template <class U>
+    void subtract(U const &other);
+    void subtract(set<T> const &other);
   };
 
   struct empty_set {
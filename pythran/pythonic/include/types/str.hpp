@@ -9,7 +9,9 @@
 #include "pythonic/include/utils/shared_ref.hpp"
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/utils/int_.hpp"
+#include "pythonic/include/utils/str_search.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <string>
 #include <cstring>
@@ -42,6 +44,8 @@ namespace types
   class sliced_str
   {
 
+    friend class str;
+
     using container_type = std::string;
     utils::shared_ref<container_type> data;
 
@@ -71,6 +75,12 @@ namespace types
     container_type const &get_data() const;
     typename S::normalized_type const &get_slice() const;
 
+    // the characters of a contiguous slice, not null terminated
+    char const *chars() const;
+    // null terminated characters, which may copy the slice into a buffer of
+    // its own
+    auto c_str() -> decltype(data->c_str());
+
     // assignment
     sliced_str &operator=(str const &);
     sliced_str &operator=(sliced_str const &);
@@ -112,7 +122,21 @@ namespace types
     friend class sliced_str;
 
     using container_type = std::string;
+    /* The string is ``(*data)[offset:offset + length]'', so that slices,
+     * split tokens and stripped strings share the buffer they come from.
+     * ``data'' and ``offset'' only change when a partial view has to be
+     * turned into a string of its own.
+     */
     utils::shared_ref<container_type> data;
+    size_t offset;
+    size_t length;
+
+    // copy a partial view into a buffer of its own
+    void own();
+    // whether the view runs to the end of the buffer, and thus is null
+    // terminated
+    bool is_suffix() const;
+    static int compare_chars(char const *s, size_t n, char const *t, size_t m);
 
   public:
     static const size_t npos = -1 /*std::string::npos*/;
@@ -144,7 +168,14 @@ namespace types
 
     types::str &operator+=(types::str const &s);
 
-    container_type const &get_data() const;
+    // a copy of the characters
+    container_type get_data() const;
+    // null terminated characters, which may copy a partial view into a
+    // buffer of its own
+    auto c_str() -> decltype(data->c_str());
+
+    // the characters of the string, not null terminated
+    char const *chars() const;
 
     long size() const;
     auto begin() const -> decltype(data->begin());
@@ -155,7 +186,6 @@ namespace types
     auto end() -> decltype(data->end());
     auto rend() const -> decltype(data->rend());
     auto rend() -> decltype(data->rend());
-    auto c_str() const -> decltype(data->c_str());
     auto resize(long n) -> decltype(data->resize(n));
     long find(str const &s, size_t pos = 0) const;
     bool contains(str const &v) const;
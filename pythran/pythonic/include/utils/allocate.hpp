@@ -0,0 +1,55 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_ALLOCATE_HPP
+#define PYTHONIC_INCLUDE_UTILS_ALLOCATE_HPP
+
+#include <cstddef>
+
+/* Memory of the shared references and of the array buffers goes through a
+ * thread local pool of small blocks, unless disabled with
+ * -DPYTHRAN_NO_POOL_ALLOCATOR.
+ */
+#ifndef PYTHRAN_NO_POOL_ALLOCATOR
+#define PYTHRAN_POOL_ALLOCATOR
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  // allocation statistics of the current thread
+  struct allocation_counters {
+    size_t allocations;
+    // allocations served by a cached block
+    size_t reuses;
+    size_t deallocations;
+    // cached blocks given back to the system
+    size_t releases;
+  };
+
+  allocation_counters const &allocation_stats();
+
+  /* Allocate ``n'' bytes, which must be deallocated with the same size.
+   *
+   * Blocks are obtained through ``malloc'' and may be given to ``free''
+   * instead, which is what numpy does with the buffers it takes over.
+   */
+  void *allocate(size_t n);
+  void deallocate(void *p, size_t n);
+
+  // give the blocks cached by the current thread back to the system
+  void release_pool();
+
+  /* While a pool scope is alive, typically during a call to an exported
+   * function, freed blocks stay cached for reuse. They are all released
+   * once the outermost scope of the thread ends.
+   */
+  struct pool_scope {
+    pool_scope();
+    ~pool_scope();
+    pool_scope(pool_scope const &) = delete;
+    pool_scope &operator=(pool_scope const &) = delete;
+  };
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_BITS_HPP
+#define PYTHONIC_INCLUDE_UTILS_BITS_HPP
+
+#include <cstdint>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  /* Bit scans and cache hints
+   *
+   * They map to the GCC and clang builtins, to the MSVC intrinsics, or to
+   * plain C++ elsewhere. Prefetches are no-ops where there is no builtin.
+   */
+
+  // index of the lowest, resp. number of bits above the highest, set bit of
+  // a non-zero word
+  int count_trailing_zeros(uint64_t word);
+  int count_leading_zeros(uint64_t word);
+  int popcount(uint64_t word);
+
+  // hint that ``address'' is about to be read, resp. written
+  void prefetch(void const *address);
+  void prefetch_for_write(void const *address);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -2,16 +2,8 @@
 #define PYTHONIC_INCLUDE_UTILS_BROADCAST_COPY_HPP
 
 #include "pythonic/include/types/tuple.hpp"
-
-#ifdef _OPENMP
-#include <omp.h>
-
-// as a macro so that an enlightened user can modify this variable :-)
-#ifndef PYTHRAN_OPENMP_MIN_ITERATION_COUNT
-#define PYTHRAN_OPENMP_MIN_ITERATION_COUNT 1000
-#endif
-
-#endif
+#include "pythonic/include/utils/transpose_copy.hpp"
+#include "pythonic/include/utils/openmp.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -0,0 +1,314 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_FLAT_HASH_MAP_HPP
+#define PYTHONIC_INCLUDE_UTILS_FLAT_HASH_MAP_HPP
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace types
+{
+  class str;
+}
+
+namespace utils
+{
+
+  /* Hash functors of the flat hash containers
+   *
+   * The low bits of a hash select a group of slots and its seven high bits
+   * are kept in the control bytes, so both ends must be well distributed.
+   * The std::hash of integers being the identity, they are mixed first.
+   */
+  template <class K>
+  struct flat_hash {
+    size_t operator()(K const &key) const;
+  };
+
+  template <>
+  struct flat_hash<long> {
+    size_t operator()(long key) const;
+  };
+
+  template <>
+  struct flat_hash<double> {
+    size_t operator()(double key) const;
+  };
+
+  template <class T>
+  struct flat_hash<std::complex<T>> {
+    size_t operator()(std::complex<T> const &key) const;
+  };
+
+  // std::hash of strings is already well distributed
+  template <>
+  struct flat_hash<types::str> {
+    size_t operator()(types::str const &key) const;
+  };
+
+  namespace flat_hash_details
+  {
+    // the control bytes of a group are processed at once as a word
+    static const size_t group_size = sizeof(uint64_t);
+
+    // control bytes: a full slot holds the seven high bits of the hash of
+    // its key, which are positive
+    static const int8_t empty = -128;
+    static const int8_t deleted = -2;
+
+    // hash of the erased entries, not used by live ones
+    static const size_t dead = ~size_t(0);
+
+    /* A group of slots of the index, the control byte of each slot being
+     * stored next to the index of the entry it refers to, if full.
+     */
+    struct group {
+      int8_t ctrl[group_size];
+      uint32_t index[group_size];
+    };
+
+    // a group whose slots are all empty
+    group empty_group();
+
+    // slots of the group whose control byte equals ``tag'', with possible
+    // false positives among full slots
+    uint64_t match(group const &g, int8_t tag);
+    // empty slots of the group
+    uint64_t match_empty(group const &g);
+    // slots of the group that are not full
+    uint64_t match_free(group const &g);
+    // position in its group of the first slot of a non-zero mask
+    size_t first_slot(uint64_t mask);
+
+    int8_t tag(size_t h);
+    // number of groups needed to hold ``n'' elements
+    size_t groups_for(size_t n);
+
+    /* Slot among ``groups'', numbered from the first group on, tagged with
+     * the hash ``h'' and whose entry index ``i'' satisfies ``is_match(i)'',
+     * or the total number of slots if there is none.
+     */
+    template <class F>
+    size_t find_slot(std::vector<group> const &groups, size_t h,
+                     F const &is_match);
+
+    // first slot along the probe sequence of ``h'' that is not full
+    size_t free_slot(std::vector<group> const &groups, size_t h);
+
+    /* An entry of the storage, whose item is only constructed while the
+     * entry is live: erased entries and unused room hold raw memory.
+     */
+    template <class T>
+    struct entry {
+      size_t hash;
+      typename std::aligned_storage<sizeof(T), alignof(T)>::type raw;
+
+      T &item();
+      T const &item() const;
+    };
+
+    /* Sequence of entries stored by chunks, so that appending an entry
+     * never moves the other ones. Each chunk is as large as all the previous
+     * ones, which keeps small maps small and indexing cheap.
+     *
+     * Entries are trivial, so allocating a chunk constructs no item. Items
+     * are constructed and destroyed in place by the table.
+     */
+    template <class E>
+    class storage
+    {
+      static const size_t first_chunk_bits = 4;
+
+      std::vector<std::unique_ptr<E[]>> chunks;
+      size_t count;
+
+      // chunk and offset in that chunk of the i-th entry
+      static size_t chunk_of(size_t i);
+      static size_t offset_of(size_t i, size_t chunk);
+
+    public:
+      storage();
+      storage(storage &&other);
+      storage &operator=(storage &&other);
+
+      size_t size() const;
+      E &operator[](size_t i);
+      E const &operator[](size_t i) const;
+      E &back();
+      // room for the entry past the last one, not counted yet
+      E &next();
+      // count the entry returned by ``next()''
+      void push_back();
+      // forget the last entry, whose item is already destroyed
+      void pop_back();
+      void clear();
+    };
+  }
+
+  /* Forward iterator over the live entries of a flat hash container */
+  template <class T, class S>
+  struct flat_hash_iterator
+      : std::iterator<std::forward_iterator_tag,
+                      typename std::remove_const<T>::type, ptrdiff_t, T *,
+                      T &> {
+    S *entries;
+    size_t index;
+
+    flat_hash_iterator() = default;
+    // ``index'' must be the one of a live entry, or the end of ``entries''
+    flat_hash_iterator(S *entries, size_t index);
+    template <class OT, class OS>
+    flat_hash_iterator(flat_hash_iterator<OT, OS> const &other);
+
+    T &operator*() const;
+    T *operator->() const;
+    flat_hash_iterator &operator++();
+    flat_hash_iterator operator++(int);
+    bool operator==(flat_hash_iterator const &other) const;
+    bool operator!=(flat_hash_iterator const &other) const;
+
+    // move to the first live entry, starting from the current one
+    flat_hash_iterator &skip();
+  };
+
+  namespace flat_hash_details
+  {
+    // key of the items of a set
+    struct identity_key {
+      template <class T>
+      T const &operator()(T const &item) const;
+    };
+
+    // key of the items of a map
+    struct first_key {
+      template <class P>
+      typename P::first_type const &operator()(P const &item) const;
+    };
+  }
+
+  /* Open addressing hash table with insertion ordered iteration
+   *
+   * As in CPython, entries are appended to a dense storage that keeps the
+   * insertion order, while an index table maps hashes to entries. The index
+   * is a Swiss table: slots are probed by groups of eight, whose control
+   * bytes are compared at once to the seven high bits of the hash within a
+   * machine word, so that most keys are only compared on a match.
+   *
+   * The storage is chunked so that references to items stay valid when new
+   * keys are inserted, as with ``std::unordered_map''. Erased entries leave
+   * a hole that is skipped during iteration, so that erasing never moves the
+   * other items either. Holes are only removed when an insertion has to
+   * rebuild the index while they outnumber live entries: that insertion
+   * moves the items.
+   *
+   * The key of an item ``t'' is ``KeyOf()(t)''.
+   */
+  template <class K, class T, class KeyOf, class Hash = flat_hash<K>>
+  class flat_hash_table
+  {
+  public:
+    using key_type = K;
+    using value_type = T;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+    using pointer = value_type *;
+    using const_pointer = value_type const *;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using allocator_type = std::allocator<value_type>;
+
+  private:
+    using entry_type = flat_hash_details::entry<value_type>;
+    using storage_type = flat_hash_details::storage<entry_type>;
+
+  public:
+    using iterator = flat_hash_iterator<value_type, storage_type>;
+    using const_iterator =
+        flat_hash_iterator<value_type const, storage_type const>;
+
+    flat_hash_table();
+    explicit flat_hash_table(size_type capacity);
+    flat_hash_table(flat_hash_table const &other);
+    flat_hash_table(flat_hash_table &&other);
+    flat_hash_table &operator=(flat_hash_table const &other);
+    flat_hash_table &operator=(flat_hash_table &&other);
+    ~flat_hash_table();
+
+    iterator begin();
+    const_iterator begin() const;
+    iterator end();
+    const_iterator end() const;
+    // last inserted entry, ``end()'' if empty
+    iterator back();
+
+    size_type size() const;
+    bool empty() const;
+
+    iterator find(K const &key);
+    const_iterator find(K const &key) const;
+    bool contains(K const &key) const;
+    // item of ``key'', appending ``make()'' if there is none
+    template <class F>
+    T &find_or_insert(K const &key, F const &make);
+    iterator erase(iterator where);
+    // number of erased items, zero or one
+    size_type erase(K const &key);
+    void clear();
+    void reserve(size_type n);
+
+  private:
+    storage_type entries;
+    std::vector<flat_hash_details::group> groups;
+    size_type live;
+    // full or deleted slots
+    size_type used;
+    // no live entry lies before that one
+    size_type head;
+
+    size_t hash(K const &key) const;
+    // slot holding ``key'', or ``capacity()''
+    size_type find_slot(K const &key, size_t h) const;
+    void insert_slot(size_type index, size_t h);
+    size_type capacity() const;
+    int8_t &ctrl_of(size_type slot);
+    uint32_t &index_of(size_type slot);
+    uint32_t index_of(size_type slot) const;
+    // rebuild the index, without moving any entry
+    void rehash(size_type ngroups);
+    // remove the holes from the storage, the index must be rebuilt then
+    void compact();
+    // destroy the items of the live entries
+    void destroy();
+  };
+
+  template <class K, class V, class Hash = flat_hash<K>>
+  class flat_hash_map
+      : public flat_hash_table<K, std::pair<K, V>,
+                               flat_hash_details::first_key, Hash>
+  {
+    using table_type = flat_hash_table<K, std::pair<K, V>,
+                                       flat_hash_details::first_key, Hash>;
+
+  public:
+    using mapped_type = V;
+    using typename table_type::value_type;
+    using typename table_type::size_type;
+
+    flat_hash_map();
+    explicit flat_hash_map(size_type capacity);
+    template <class B, class E>
+    flat_hash_map(B begin, E end);
+
+    V &operator[](K const &key);
+  };
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,193 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_FLAT_HASH_SET_HPP
+#define PYTHONIC_INCLUDE_UTILS_FLAT_HASH_SET_HPP
+
+#include "pythonic/include/utils/flat_hash_map.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  namespace flat_hash_details
+  {
+    /* Order preserving mapping of integers to unsigned keys, used to store
+     * them in a bitset. Other types have no such key.
+     */
+    template <class T, bool = std::is_integral<T>::value &&
+                              sizeof(T) <= sizeof(uint64_t)>
+    struct dense_key {
+      static const bool value = false;
+      static uint64_t to_key(T const &item);
+      static T from_key(uint64_t key);
+    };
+
+    template <class T>
+    struct dense_key<T, true> {
+      static const bool value = true;
+      static uint64_t to_key(T item);
+      static T from_key(uint64_t key);
+    };
+
+    /* Set of keys stored as a bitset over a range of words
+     *
+     * The range grows to hold new keys as long as it does not get much
+     * larger than the number of keys, so that set operations on two bitsets
+     * are word wise loops over their common range that the compiler
+     * vectorizes.
+     */
+    class dense_bits
+    {
+      std::vector<uint64_t> words;
+      // key of the first bit of ``words'', divided by 64
+      uint64_t first;
+      size_t count;
+      // no bit is set before that word
+      size_t head;
+
+      // whether ``nwords'' words are dense enough to hold ``n'' keys
+      static bool fits(uint64_t nwords, size_t n);
+      // extend the range of words to ``[lo, hi]''
+      void widen(uint64_t lo, uint64_t hi);
+      void recount();
+
+    public:
+      dense_bits();
+
+      size_t size() const;
+      bool contains(uint64_t key) const;
+      // false if the bitset would be too sparse to hold ``key''
+      bool insert(uint64_t key);
+      bool erase(uint64_t key);
+      // remove the lowest key, the bitset must not be empty
+      uint64_t pop();
+      void clear();
+
+      // positions of the keys, ``end_pos()'' being past the last one
+      size_t begin_pos() const;
+      size_t end_pos() const;
+      // position of the first key after ``pos''
+      size_t next_pos(size_t pos) const;
+      uint64_t key_at(size_t pos) const;
+
+      // false, leaving the set untouched, if the union would be too sparse
+      bool merge(dense_bits const &other);
+      void intersect(dense_bits const &other);
+      void subtract(dense_bits const &other);
+      bool is_subset_of(dense_bits const &other) const;
+      bool is_disjoint_from(dense_bits const &other) const;
+    };
+  }
+
+  template <class T, class Hash>
+  class flat_hash_set;
+
+  /* Forward iterator over a flat hash set, in either of its layouts */
+  template <class T, class Hash>
+  struct flat_hash_set_iterator
+      : std::iterator<std::forward_iterator_tag, T, ptrdiff_t, T const *,
+                      T const &> {
+    using item_iterator =
+        typename flat_hash_table<T, T, flat_hash_details::identity_key,
+                                 Hash>::const_iterator;
+
+    // bitset of a dense set, null otherwise
+    flat_hash_details::dense_bits const *bits;
+    size_t pos;
+    // current item of a dense set
+    T value;
+    item_iterator item;
+
+    flat_hash_set_iterator() = default;
+    flat_hash_set_iterator(flat_hash_details::dense_bits const *bits,
+                           size_t pos);
+    flat_hash_set_iterator(item_iterator item);
+
+    T const &operator*() const;
+    T const *operator->() const;
+    flat_hash_set_iterator &operator++();
+    flat_hash_set_iterator operator++(int);
+    bool operator==(flat_hash_set_iterator const &other) const;
+    bool operator!=(flat_hash_set_iterator const &other) const;
+
+  private:
+    // reads ``value'' from the bitset, unless past the end
+    void load();
+  };
+
+  /* Hash set built on a flat hash table
+   *
+   * Integers start in a bitset, ordered, whose range covers the inserted
+   * ones. Once they are too sparse for it, they move to the hash table for
+   * good, and iterate in insertion order. Set operations between two
+   * bitsets work on whole words, others probe the larger set with the items
+   * of the smaller one.
+   */
+  template <class T, class Hash = flat_hash<T>>
+  class flat_hash_set
+  {
+    using key_traits = flat_hash_details::dense_key<T>;
+    using table_type =
+        flat_hash_table<T, T, flat_hash_details::identity_key, Hash>;
+
+    table_type table;
+    flat_hash_details::dense_bits bits;
+    // whether the items are in ``bits'' rather than in ``table''
+    bool dense;
+
+  public:
+    using key_type = T;
+    using value_type = T;
+    using reference = value_type const &;
+    using const_reference = value_type const &;
+    using pointer = value_type const *;
+    using const_pointer = value_type const *;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using allocator_type = std::allocator<value_type>;
+    using iterator = flat_hash_set_iterator<T, Hash>;
+    using const_iterator = iterator;
+
+    flat_hash_set();
+    template <class B, class E>
+    flat_hash_set(B begin, E end);
+
+    iterator begin() const;
+    iterator end() const;
+
+    size_type size() const;
+    bool empty() const;
+    bool contains(T const &item) const;
+
+    void insert(T const &item);
+    template <class B, class E>
+    void insert(B begin, E end);
+    // number of erased items, zero or one
+    size_type erase(T const &item);
+    // remove the first item, the set must not be empty
+    T pop();
+    void clear();
+    void reserve(size_type n);
+
+    void merge(flat_hash_set const &other);
+    void intersect(flat_hash_set const &other);
+    void subtract(flat_hash_set const &other);
+    bool is_subset_of(flat_hash_set const &other) const;
+    bool is_disjoint_from(flat_hash_set const &other) const;
+    bool operator==(flat_hash_set const &other) const;
+
+  private:
+    bool is_dense() const;
+    // move the items from the bitset to the table
+    void make_sparse();
+  };
+}
+PYTHONIC_NS_END
+
+#endif
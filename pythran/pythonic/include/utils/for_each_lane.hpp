@@ -0,0 +1,31 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_FOR_EACH_LANE_HPP
+#define PYTHONIC_INCLUDE_UTILS_FOR_EACH_LANE_HPP
+
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/utils/transpose_copy.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  /* Apply ``f'' to each lane of ``self'' along ``axis'', in place
+   *
+   * A lane is the 1D sequence of elements obtained by fixing every index but
+   * the one along ``axis'', which must be in ``[0, N)''. ``f'' is called as
+   * ``f(first, last, lane)'' where ``[first, last)'' is a contiguous range
+   * holding the lane, and ``lane'' is the flat index of the lane in the
+   * array of shape ``self.shape()'' without ``axis''. Modifications of the
+   * range are written back to ``self''.
+   *
+   * Lanes along the last axis are passed without any copy. Lanes along other
+   * axes are strided: they are transposed by blocks into a contiguous buffer
+   * and back. Lanes are dispatched among OpenMP threads, each thread working
+   * on its own copy of ``f''.
+   */
+  template <class T, size_t N, class F>
+  void for_each_lane(types::ndarray<T, N> &self, long axis, F const &f);
+}
+PYTHONIC_NS_END
+
+#endif
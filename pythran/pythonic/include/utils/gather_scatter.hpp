@@ -0,0 +1,37 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_GATHER_SCATTER_HPP
+#define PYTHONIC_INCLUDE_UTILS_GATHER_SCATTER_HPP
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  /* Indexed copies between contiguous buffers
+   *
+   * Items are blocks of ``block'' elements, ``size'' being the number of
+   * items of the indexed buffer. Runs of consecutive indices are copied at
+   * once. The remaining items go through Boost.SIMD gathers, hardware ones
+   * on AVX2, for scalar items of four or eight bytes, and the items a few
+   * steps ahead are prefetched when the indexed buffer does not fit in
+   * cache. Large gathers are split among OpenMP threads, and so are
+   * scatters whose indices are strictly increasing, as the other ones may
+   * write the same item twice.
+   *
+   * Indices are assumed to be in [-size, size), negative ones counting
+   * from the end.
+   */
+
+  // out[i] = src[idx[i]] for i < n
+  template <class T, class I>
+  void gather(T *out, T const *src, long size, long block, I const *idx,
+              long n);
+
+  // dst[idx[i]] = src[i % m] for i < n, later items winning and values
+  // being converted to T
+  template <class T, class I, class V>
+  void scatter(T *dst, long size, long block, I const *idx, long n,
+               V const *src, long m);
+}
+PYTHONIC_NS_END
+
+#endif
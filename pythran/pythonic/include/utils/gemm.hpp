@@ -0,0 +1,42 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_GEMM_HPP
+#define PYTHONIC_INCLUDE_UTILS_GEMM_HPP
+
+#include <cstddef>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  /* Packed matrix product, ``c += a.b''
+   *
+   * ``a'' is a ``m'' x ``k'' matrix, ``b'' a ``k'' x ``n'' one, both being
+   * read through ``x.fast(i).fast(j)'' so that any 2D array or expression,
+   * transposed or strided, is accepted without evaluating it first. ``c'' is
+   * a contiguous ``m'' x ``n'' buffer.
+   *
+   * Blocks of ``a'' and ``b'' are copied to contiguous panels of ``MR'' rows
+   * and ``NR'' columns, converted to ``T''. A fully unrolled micro kernel
+   * accumulates a ``MR'' x ``NR'' tile of ``c'' in registers, which the
+   * compiler vectorizes. Tiles are dispatched among OpenMP threads, which
+   * only read the panels.
+   */
+  template <size_t MR, size_t NR, class T, class A, class B>
+  void gemm(T *c, A const &a, B const &b, long m, long n, long k);
+
+  /* Matrix vector products, ``c = a.v'' and ``c = v.b''
+   *
+   * ``a'' is a ``m'' x ``k'' matrix and ``b'' a ``k'' x ``n'' one, read row
+   * by row as for ``gemm''. These products read each element once, so the
+   * matrix is streamed rather than packed. The rows of ``c'', or blocks of
+   * its columns, are dispatched among OpenMP threads.
+   */
+  template <class T, class A, class V>
+  void gemv(T *c, A const &a, V const &v, long m, long k);
+
+  template <class T, class V, class B>
+  void gevm(T *c, V const &v, B const &b, long k, long n);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_NPY_FORMAT_HPP
+#define PYTHONIC_INCLUDE_UTILS_NPY_FORMAT_HPP
+
+#include "pythonic/include/types/str.hpp"
+
+#include <string>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  // file descriptor closed on destruction
+  struct file_descriptor {
+    int fd;
+    file_descriptor(types::str const &filename, int flags);
+    file_descriptor(file_descriptor const &) = delete;
+    ~file_descriptor();
+    // size of a regular file, -1 for anything else
+    long size() const;
+    // read ``n'' bytes, fewer at the end of the file
+    size_t read(char *out, size_t n) const;
+    void write(char const *s, size_t n) const;
+  };
+
+  /* Writing of the .npy file format
+   *
+   * A .npy file starts with a magic string, a version and a Python dict
+   * literal describing the type, layout and shape of the array, padded so
+   * that the raw data that follows is aligned.
+   */
+  namespace npy
+  {
+    // type description of ``T'', e.g. ``<f8''
+    template <class T>
+    std::string descr();
+
+    // preamble of a C ordered array of ``T'' of the ``n'' dimensions at
+    // ``shape''
+    template <class T>
+    std::string write_header(long const *shape, size_t n);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_OPENMP_HPP
+#define PYTHONIC_INCLUDE_UTILS_OPENMP_HPP
+
+#ifdef _OPENMP
+#include <omp.h>
+
+// as a macro so that an enlightened user can modify this variable :-)
+#ifndef PYTHRAN_OPENMP_MIN_ITERATION_COUNT
+#define PYTHRAN_OPENMP_MIN_ITERATION_COUNT 1000
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_PREFIX_SCAN_HPP
+#define PYTHONIC_INCLUDE_UTILS_PREFIX_SCAN_HPP
+
+#include <type_traits>
+
+PYTHONIC_NS_BEGIN
+
+namespace operator_
+{
+  namespace functor
+  {
+    struct add;
+    struct imul;
+  }
+}
+
+namespace numpy
+{
+  namespace functor
+  {
+    struct add;
+    struct multiply;
+    struct fmax;
+    struct fmin;
+    struct maximum;
+    struct minimum;
+    struct bitwise_and;
+    struct bitwise_or;
+    struct bitwise_xor;
+    struct logical_and;
+    struct logical_or;
+    struct logical_xor;
+  }
+}
+
+namespace utils
+{
+
+  /* Inclusive scans of contiguous buffers
+   *
+   * Scans along an axis run down the independent lanes of the following
+   * axes at once, and split them among OpenMP threads. Scans of a single
+   * lane cut it into blocks of fixed size. Blocks are scanned in parallel
+   * when the operator is associative: each thread scans its own blocks, and
+   * the combined totals of the blocks on their left are then applied to
+   * them. Inside a block, sums and products of vectorizable types are
+   * scanned in Boost.SIMD registers, which reassociates floating point
+   * additions and products as any parallel scan does.
+   *
+   * Values are converted to the type of the output before being combined,
+   * and each result is converted back to it, as numpy does.
+   */
+
+  template <class Op>
+  struct is_associative : std::false_type {
+  };
+
+  // scans that run in Boost.SIMD registers
+  struct scan_sum;
+  struct scan_product;
+  template <class Op>
+  struct vector_scan {
+    using type = void;
+  };
+
+#define PYTHONIC_ASSOCIATIVE_SCAN(Op, Vector)                                 \
+  template <>                                                                  \
+  struct is_associative<Op> : std::true_type {                                \
+  };                                                                           \
+  template <>                                                                  \
+  struct vector_scan<Op> {                                                     \
+    using type = Vector;                                                       \
+  };
+
+  PYTHONIC_ASSOCIATIVE_SCAN(operator_::functor::add, scan_sum)
+  PYTHONIC_ASSOCIATIVE_SCAN(numpy::functor::add, scan_sum)
+  PYTHONIC_ASSOCIATIVE_SCAN(operator_::functor::imul, scan_product)
+  PYTHONIC_ASSOCIATIVE_SCAN(numpy::functor::multiply, scan_product)
+  PYTHONIC_ASSOCIATIVE_SCAN(numpy::functor::fmax, void)
+  PYTHONIC_ASSOCIATIVE_SCAN(numpy::functor::fmin, void)
+  PYTHONIC_ASSOCIATIVE_SCAN(numpy::functor::maximum, void)
+  PYTHONIC_ASSOCIATIVE_SCAN(numpy::functor::minimum, void)
+  PYTHONIC_ASSOCIATIVE_SCAN(numpy::functor::bitwise_and, void)
+  PYTHONIC_ASSOCIATIVE_SCAN(numpy::functor::bitwise_or, void)
+  PYTHONIC_ASSOCIATIVE_SCAN(numpy::functor::bitwise_xor, void)
+  PYTHONIC_ASSOCIATIVE_SCAN(numpy::functor::logical_and, void)
+  PYTHONIC_ASSOCIATIVE_SCAN(numpy::functor::logical_or, void)
+  PYTHONIC_ASSOCIATIVE_SCAN(numpy::functor::logical_xor, void)
+
+#undef PYTHONIC_ASSOCIATIVE_SCAN
+
+  // dst[i] = Op(dst[i - 1], src[i]) for i < n, ``src'' may be ``dst''
+  template <class Op, class T, class S>
+  void inclusive_scan(S const *src, T *dst, long n);
+
+  // the same along the middle axis of (outer, n, inner) buffers
+  template <class Op, class T, class S>
+  void inclusive_scan(S const *src, T *dst, long outer, long n, long inner);
+}
+PYTHONIC_NS_END
+
+#endif
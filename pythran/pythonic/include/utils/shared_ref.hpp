@@ -1,6 +1,8 @@
 #ifndef PYTHONIC_INCLUDE_UTILS_SHARED_REF_HPP
 #define PYTHONIC_INCLUDE_UTILS_SHARED_REF_HPP
 
+#include "pythonic/include/utils/allocate.hpp"
+
 #include <memory>
 #include <utility>
 #include <unordered_map>
@@ -18,7 +20,11 @@ using extern_type = PyObject *;
 using extern_type = void *;
 #endif
 
-#ifdef _OPENMP
+/* Reference counts are atomic when OpenMP is enabled, unless the module
+ * shares no reference counted value between threads, in which case
+ * pythran defines PYTHRAN_NON_ATOMIC_REFCOUNT.
+ */
+#if defined(_OPENMP) && !defined(PYTHRAN_NON_ATOMIC_REFCOUNT)
 using atomic_size_t = std::atomic_size_t;
 #else
 using atomic_size_t = size_t;
@@ -33,7 +39,8 @@ namespace utils
 
   /** Light-weight shared_ptr like-class
    *
-   *  Unlike std::shared_ptr, it allocates the memory itself using new.
+   *  Unlike std::shared_ptr, it allocates the memory itself, from the pool
+   *  of utils::allocate.
    */
   template <class T>
   class shared_ref
@@ -94,6 +101,8 @@ namespace utils
     bool is_foreign() const;
 
   private:
+    template <class... Types>
+    static memory *create(Types &&... args);
     void dispose();
     void acquire();
   };
@@ -0,0 +1,36 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_STR_SEARCH_HPP
+#define PYTHONIC_INCLUDE_UTILS_STR_SEARCH_HPP
+
+#include <cstddef>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  /* Search kernels over the ``n'' characters at ``s''
+   *
+   * With Boost.SIMD, whole vectors of characters are compared at once and
+   * the matching lanes are read back as a bit mask. Otherwise, single
+   * characters go through ``memchr'' and character sets through a lookup
+   * table. Positions are returned as indices, ``-1'' meaning not found.
+   */
+
+  // first occurrence of the ``m'' characters at ``needle''
+  long find(char const *s, size_t n, char const *needle, size_t m);
+
+  // first, resp. last, character that is, resp. is not, one of the ``k''
+  // characters at ``set''
+  long find_first_of(char const *s, size_t n, char const *set, size_t k);
+  long find_first_not_of(char const *s, size_t n, char const *set, size_t k);
+  long find_last_not_of(char const *s, size_t n, char const *set, size_t k);
+
+  // ASCII character classes, as for the C locale
+  bool all_digits(char const *s, size_t n);
+  bool all_alpha(char const *s, size_t n);
+  void to_upper(char *out, char const *s, size_t n);
+  void to_lower(char *out, char const *s, size_t n);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_STREAM_COMPACTION_HPP
+#define PYTHONIC_INCLUDE_UTILS_STREAM_COMPACTION_HPP
+
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace types
+{
+  template <class T, size_t N>
+  struct ndarray;
+}
+
+namespace utils
+{
+
+  /* Stream compaction of the non zero items of a buffer
+   *
+   * The buffer is cut into chunks. The non zero items of each chunk are
+   * counted first, 64 at a time, as the popcount of a mask word built with
+   * Boost.SIMD comparisons when it is enabled. The exclusive prefix sum of
+   * these counts gives the exact size of the output and the position of
+   * each chunk in it, so that chunks are then packed independently, by
+   * several OpenMP threads for large buffers.
+   */
+  template <class T>
+  struct nonzero_compaction {
+    T const *data;
+    long n;
+    // offsets[c] is the position of the first non zero item of chunk ``c''
+    // in the output, the last offset is the number of non zero items
+    std::vector<long> offsets;
+
+    nonzero_compaction(T const *data, long n);
+
+    long size() const;
+
+    // calls f(k, i) for the k-th non zero item, at index ``i'', possibly
+    // from several threads at once
+    template <class F>
+    void operator()(F const &f) const;
+  };
+
+  // ``e'' as a contiguous array, without a copy if it already is one
+  template <class T, size_t N>
+  types::ndarray<T, N> const &dense(types::ndarray<T, N> const &e);
+
+  template <class E>
+  types::ndarray<typename E::dtype, E::value> dense(E const &e);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_TRANSPOSE_COPY_HPP
+#define PYTHONIC_INCLUDE_UTILS_TRANSPOSE_COPY_HPP
+
+#include <type_traits>
+
+// as a macro so that an enlightened user can modify this variable :-)
+// it should be a multiple of the widest SIMD register, in elements
+#ifndef PYTHRAN_TRANSPOSE_TILE_SIZE
+#define PYTHRAN_TRANSPOSE_TILE_SIZE 64
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace types
+{
+  template <class T, size_t N>
+  struct ndarray;
+
+  template <class Arg, class... S>
+  struct numpy_gexpr;
+
+  struct contiguous_slice;
+}
+
+namespace utils
+{
+
+  /* Cache-blocked out-of-place transposition
+   *
+   * Computes ``dst[i, j] = src[j, i]'' for ``i < rows'' and ``j < cols'',
+   * where ``dst_stride'' (resp. ``src_stride'') is the distance, in
+   * elements, between two consecutive rows of ``dst'' (resp. ``src'').
+   *
+   * The copy is performed tile by tile so that both the reads and the writes
+   * stay in cache, each tile being transposed in registers when Boost.SIMD is
+   * enabled, and tiles are dispatched among OpenMP threads.
+   */
+  template <class T>
+  void transpose_copy(T *dst, long dst_stride, T const *src, long src_stride,
+                      long rows, long cols);
+
+  /* trait to detect 2D arrays whose rows are contiguous in memory and that
+   * can thus be the target of a ``transpose_copy''
+   */
+  template <class E>
+  struct transpose_buffer : std::false_type {
+  };
+
+  template <class T>
+  struct transpose_buffer<types::ndarray<T, 2>> : std::true_type {
+    static T *data(types::ndarray<T, 2> &self);
+    static long stride(types::ndarray<T, 2> const &self);
+  };
+
+  template <class E>
+  struct is_ndarray2 : std::false_type {
+  };
+
+  template <class T>
+  struct is_ndarray2<types::ndarray<T, 2>> : std::true_type {
+  };
+
+  template <class... S>
+  struct all_contiguous_slices : std::true_type {
+  };
+
+  template <class S0, class... S>
+  struct all_contiguous_slices<S0, S...>
+      : std::integral_constant<
+            bool, std::is_same<S0, types::contiguous_slice>::value &&
+                      all_contiguous_slices<S...>::value> {
+  };
+
+  template <class Arg, class... S>
+  struct transpose_buffer<types::numpy_gexpr<Arg, S...>>
+      : std::integral_constant<
+            bool, is_ndarray2<typename std::decay<Arg>::type>::value &&
+                      all_contiguous_slices<S...>::value> {
+    using dtype = typename std::decay<Arg>::type::dtype;
+    static dtype *data(types::numpy_gexpr<Arg, S...> &self);
+    static long stride(types::numpy_gexpr<Arg, S...> const &self);
+  };
+}
+PYTHONIC_NS_END
+
+#endif
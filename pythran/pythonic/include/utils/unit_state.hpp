@@ -0,0 +1,21 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_UNIT_STATE_HPP
+#define PYTHONIC_INCLUDE_UTILS_UNIT_STATE_HPP
+
+/* Modules split into several translation units share the wrappers of their
+ * overloads between them, but not with other modules.
+ */
+#ifdef _WIN32
+#define PYTHRAN_UNIT_LINKAGE
+#else
+#define PYTHRAN_UNIT_LINKAGE __attribute__((visibility("hidden")))
+#endif
+
+/* The pythonic namespace is private to each translation unit, so runtime
+ * state that all the units of a module must see, such as the seeds of the
+ * random generators, lives in the ``pythonic_shared'' namespace instead,
+ * with PYTHRAN_UNIT_LINKAGE. It is only defined by the units that do not
+ * define PYTHRAN_EXTERN_UNIT_STATE: the single unit of a module, or the
+ * first unit of a split one.
+ */
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef PYTHONIC_NUMPY_ARGPARTITION_HPP
+#define PYTHONIC_NUMPY_ARGPARTITION_HPP
+
+#include "pythonic/include/numpy/argpartition.hpp"
+
+#include <functional>
+#include <numeric>
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/for_each_lane.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/NoneType.hpp"
+#include "pythonic/numpy/partition.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class T, size_t N, class K>
+  types::ndarray<long, N> argpartition(types::ndarray<T, N> const &a,
+                                       K const &kth, long axis)
+  {
+    axis = details::normalize_axis(axis, N);
+    auto &&shape = a.shape();
+    long const lane_size = shape[axis];
+    long const stride = std::accumulate(shape.begin() + axis + 1, shape.end(),
+                                        1L, std::multiplies<long>());
+    std::vector<long> kths = details::normalize_kth(kth, lane_size);
+    types::ndarray<long, N> indices(shape, __builtin__::None);
+    T const *values = a.buffer;
+    // the lanes of indices are filled and partitioned in one go, comparing
+    // the matching values of ``a''
+    utils::for_each_lane(indices, axis, [&kths, values, lane_size, stride](
+                                            long *first, long *last,
+                                            long lane) {
+      T const *lane_values =
+          values + (lane / stride) * lane_size * stride + lane % stride;
+      std::iota(first, last, 0L);
+      details::partition_lane(first, last, kths,
+                              [lane_values, stride](long i, long j) {
+                                return _comp<T>{}(lane_values[i * stride],
+                                                  lane_values[j * stride]);
+                              });
+    });
+    return indices;
+  }
+
+  template <class T, size_t N, class K>
+  types::ndarray<long, 1> argpartition(types::ndarray<T, N> const &a,
+                                       K const &kth, types::none_type)
+  {
+    return argpartition(a.flat(), kth, 0);
+  }
+
+  NUMPY_EXPR_TO_NDARRAY0_IMPL(argpartition);
+
+  DEFINE_FUNCTOR(pythonic::numpy, argpartition);
+}
+PYTHONIC_NS_END
+
+#endif
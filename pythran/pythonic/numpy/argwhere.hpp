@@ -5,7 +5,9 @@
 
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/NoneType.hpp"
 #include "pythonic/numpy/asarray.hpp"
+#include "pythonic/utils/stream_compaction.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -17,29 +19,22 @@ namespace numpy
     using out_type = typename types::ndarray<long, 2>;
     constexpr long N = E::value;
     auto arr = asarray(expr);
-    long sz = arr.flat_size();
-    auto eshape = arr.shape();
-
-    utils::shared_ref<types::raw_array<long>> buffer(sz *
-                                                     N); // too much memory used
-    long *buffer_iter = buffer->data;
-
-    long real_sz = 0;
-    auto iter = arr.fbegin();
-    for (long i = 0; i < sz; ++i, ++iter) {
-      if (*iter) {
-        ++real_sz;
-        long mult = 1;
-        for (long j = N - 1; j > 0; j--) {
-          buffer_iter[j] = (i / mult) % eshape[j];
-          mult *= eshape[j];
-        }
-        buffer_iter[0] = i / mult;
-        buffer_iter += N;
+    auto const eshape = arr.shape();
+    utils::nonzero_compaction<typename decltype(arr)::dtype> compaction(
+        arr.buffer, arr.flat_size());
+
+    types::array<long, 2> shape = {compaction.size(), N};
+    out_type out(shape, __builtin__::None);
+    long *buffer = out.buffer;
+    compaction([buffer, eshape](long k, long i) {
+      long *row = buffer + k * N;
+      for (long j = N - 1; j > 0; --j) {
+        row[j] = i % eshape[j];
+        i /= eshape[j];
       }
-    }
-    types::array<long, 2> shape = {real_sz, N};
-    return out_type(buffer, shape);
+      row[0] = i;
+    });
+    return out;
   }
 
   DEFINE_FUNCTOR(pythonic::numpy, argwhere);
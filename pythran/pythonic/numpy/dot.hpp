@@ -7,6 +7,7 @@
 #include "pythonic/numpy/sum.hpp"
 #include "pythonic/types/numpy_expr.hpp"
 #include "pythonic/types/traits.hpp"
+#include "pythonic/utils/gemm.hpp"
 
 #if defined(PYTHRAN_BLAS_ATLAS)
 extern "C" {
@@ -108,8 +109,161 @@ namespace numpy
     return out;
   }
 
-  // If arguments could be use with blas, we evaluate them as we need pointer
-  // on array for blas
+  namespace details
+  {
+    /* An operand as BLAS reads it in place: the ``i''-th row of a matrix, or
+     * element of a vector, lies ``i * ld'' elements after ``data''. The rows
+     * of the stored matrix are the columns of the operand if ``trans'' is
+     * set. ``data'' is null if the operand must be copied first.
+     */
+    template <class T>
+    struct blas_operand {
+      T *data;
+      long ld;
+      bool trans;
+    };
+
+    template <class T, class E>
+    blas_operand<T> blas_view(E const &)
+    {
+      return {nullptr, 0, false};
+    }
+
+    template <class T, size_t N>
+    blas_operand<T> blas_view(types::ndarray<T, N> const &a)
+    {
+      return {a.buffer, N == 1 ? 1 : a.shape()[N - 1], false};
+    }
+
+    // a row of a matrix
+    template <class T, class Arg>
+    typename std::enable_if<
+        std::is_same<typename std::decay<Arg>::type,
+                     types::ndarray<T, 2>>::value,
+        blas_operand<T>>::type
+    blas_view(types::numpy_iexpr<Arg> const &a)
+    {
+      return {a.buffer, 1, false};
+    }
+
+    // rows, or elements, sliced with a positive step
+    template <class T, class Arg, class S>
+    typename std::enable_if<
+        std::is_same<typename std::decay<Arg>::type,
+                     types::ndarray<T, 1>>::value ||
+            std::is_same<typename std::decay<Arg>::type,
+                         types::ndarray<T, 2>>::value,
+        blas_operand<T>>::type
+    blas_view(types::numpy_gexpr<Arg, S> const &a)
+    {
+      auto const &rows = std::get<0>(a.slices);
+      if (rows.step <= 0)
+        return {nullptr, 0, false};
+      using A = typename std::decay<Arg>::type;
+      long const row_size = A::value == 1 ? 1 : a.arg.shape()[A::value - 1];
+      return {a.buffer + rows.lower * row_size, rows.step * row_size, false};
+    }
+
+    // rows sliced with a positive step, and columns with a unit one
+    template <class T, class Arg, class S0, class S1>
+    typename std::enable_if<std::is_same<typename std::decay<Arg>::type,
+                                         types::ndarray<T, 2>>::value,
+                            blas_operand<T>>::type
+    blas_view(types::numpy_gexpr<Arg, S0, S1> const &a)
+    {
+      auto const &rows = std::get<0>(a.slices);
+      auto const &cols = std::get<1>(a.slices);
+      if (rows.step <= 0 || cols.step != 1)
+        return {nullptr, 0, false};
+      long const row_size = a.arg.shape()[1];
+      return {a.buffer + rows.lower * row_size + cols.lower,
+              rows.step * row_size, false};
+    }
+
+    template <class T, class Arg>
+    blas_operand<T> blas_view(types::numpy_texpr<Arg> const &a)
+    {
+      blas_operand<T> view = blas_view<T>(a.arg);
+      view.trans = !view.trans;
+      return view;
+    }
+
+    // view of ``e'', which is first copied to ``copy'' if BLAS cannot read
+    // it in place
+    template <class T, size_t N, class E>
+    blas_operand<T> make_blas_operand(E const &e, types::ndarray<T, N> &copy)
+    {
+      blas_operand<T> view = blas_view<T>(e);
+      if (!view.data) {
+        copy = types::ndarray<T, N>(e);
+        view = blas_view<T>(copy);
+      }
+      return view;
+    }
+  }
+
+  // ``y = a.x'' where ``a'' is a ``m'' x ``k'' matrix
+#define GEMV_DEF(T, L)                                                         \
+  void gemv(details::blas_operand<T> const &a, int m, int k,                   \
+            details::blas_operand<T> const &x, T *y)                           \
+  {                                                                            \
+    if (a.trans)                                                               \
+      cblas_##L##gemv(CblasRowMajor, CblasTrans, k, m, 1, a.data, a.ld,        \
+                      x.data, x.ld, 0, y, 1);                                  \
+    else                                                                       \
+      cblas_##L##gemv(CblasRowMajor, CblasNoTrans, m, k, 1, a.data, a.ld,      \
+                      x.data, x.ld, 0, y, 1);                                  \
+  }
+  GEMV_DEF(double, d)
+  GEMV_DEF(float, s)
+#undef GEMV_DEF
+#define GEMV_DEF(T, K, L)                                                      \
+  void gemv(details::blas_operand<T> const &a, int m, int k,                   \
+            details::blas_operand<T> const &x, T *y)                           \
+  {                                                                            \
+    T alpha = 1, beta = 0;                                                     \
+    if (a.trans)                                                               \
+      cblas_##L##gemv(CblasRowMajor, CblasTrans, k, m, (K *)&alpha,            \
+                      (K *)a.data, a.ld, (K *)x.data, x.ld, (K *)&beta,        \
+                      (K *)y, 1);                                              \
+    else                                                                       \
+      cblas_##L##gemv(CblasRowMajor, CblasNoTrans, m, k, (K *)&alpha,          \
+                      (K *)a.data, a.ld, (K *)x.data, x.ld, (K *)&beta,        \
+                      (K *)y, 1);                                              \
+  }
+  GEMV_DEF(std::complex<float>, float, c)
+  GEMV_DEF(std::complex<double>, double, z)
+#undef GEMV_DEF
+
+  // ``c = a.b'' where ``a'' is a ``m'' x ``k'' matrix and ``b'' a ``k'' x
+  // ``n'' one
+#define GEMM_DEF(T, L)                                                         \
+  void gemm(details::blas_operand<T> const &a,                                 \
+            details::blas_operand<T> const &b, int m, int n, int k, T *c)      \
+  {                                                                            \
+    cblas_##L##gemm(CblasRowMajor, a.trans ? CblasTrans : CblasNoTrans,        \
+                    b.trans ? CblasTrans : CblasNoTrans, m, n, k, 1, a.data,   \
+                    a.ld, b.data, b.ld, 0, c, n);                              \
+  }
+  GEMM_DEF(double, d)
+  GEMM_DEF(float, s)
+#undef GEMM_DEF
+#define GEMM_DEF(T, K, L)                                                      \
+  void gemm(details::blas_operand<T> const &a,                                 \
+            details::blas_operand<T> const &b, int m, int n, int k, T *c)      \
+  {                                                                            \
+    T alpha = 1, beta = 0;                                                     \
+    cblas_##L##gemm(CblasRowMajor, a.trans ? CblasTrans : CblasNoTrans,        \
+                    b.trans ? CblasTrans : CblasNoTrans, m, n, k,              \
+                    (K *)&alpha, (K *)a.data, a.ld, (K *)b.data, b.ld,         \
+                    (K *)&beta, (K *)c, n);                                    \
+  }
+  GEMM_DEF(std::complex<float>, float, c)
+  GEMM_DEF(std::complex<double>, double, z)
+#undef GEMM_DEF
+
+  // If arguments could be use with blas, we pass strided views of arrays as
+  // is and evaluate the other ones, as we need pointer on array for blas
   template <class E, class F>
   typename std::enable_if<
       types::is_numexpr_arg<E>::value &&
@@ -125,17 +279,19 @@ namespace numpy
           1>>::type
   dot(E const &e, F const &f)
   {
-    types::ndarray<
-        typename __combined<typename E::dtype, typename F::dtype>::type, 2> e_ =
-        e;
-    types::ndarray<
-        typename __combined<typename E::dtype, typename F::dtype>::type, 1> f_ =
-        f;
-    return dot(e_, f_);
+    using T = typename __combined<typename E::dtype, typename F::dtype>::type;
+    types::ndarray<T, 2> e_;
+    types::ndarray<T, 1> f_;
+    auto a = details::make_blas_operand(e, e_);
+    auto x = details::make_blas_operand(f, f_);
+    types::ndarray<T, 1> out(types::array<long, 1>{{e.shape()[0]}},
+                             __builtin__::None);
+    gemv(a, e.shape()[0], e.shape()[1], x, out.buffer);
+    return out;
   }
 
-  // If arguments could be use with blas, we evaluate them as we need pointer
-  // on array for blas
+  // If arguments could be use with blas, we pass strided views of arrays as
+  // is and evaluate the other ones, as we need pointer on array for blas
   template <class E, class F>
   typename std::enable_if<
       types::is_numexpr_arg<E>::value &&
@@ -151,17 +307,21 @@ namespace numpy
           1>>::type
   dot(E const &e, F const &f)
   {
-    types::ndarray<
-        typename __combined<typename E::dtype, typename F::dtype>::type, 1> e_ =
-        e;
-    types::ndarray<
-        typename __combined<typename E::dtype, typename F::dtype>::type, 2> f_ =
-        f;
-    return dot(e_, f_);
+    using T = typename __combined<typename E::dtype, typename F::dtype>::type;
+    types::ndarray<T, 1> e_;
+    types::ndarray<T, 2> f_;
+    auto x = details::make_blas_operand(e, e_);
+    auto b = details::make_blas_operand(f, f_);
+    // v.b is the product of the transpose of b and v
+    b.trans = !b.trans;
+    types::ndarray<T, 1> out(types::array<long, 1>{{f.shape()[1]}},
+                             __builtin__::None);
+    gemv(b, f.shape()[1], f.shape()[0], x, out.buffer);
+    return out;
   }
 
-  // If one of the arg doesn't have a "blas compatible type", we use a slow
-  // matrix vector multiplication.
+  // If one of the arg doesn't have a "blas compatible type", we use our own
+  // packed matrix vector multiplication.
   template <class E, class F>
   typename std::enable_if<
       (!is_blas_type<typename E::dtype>::value ||
@@ -172,17 +332,15 @@ namespace numpy
           1>>::type
   dot(E const &e, F const &f)
   {
-    types::ndarray<
-        typename __combined<typename E::dtype, typename F::dtype>::type, 1>
-    out(types::array<long, 1>{{f.shape()[1]}}, 0);
-    for (long i = 0; i < out.shape()[0]; i++)
-      for (long j = 0; j < f.shape()[0]; j++)
-        out[i] += e[j] * f[types::array<long, 2>{{j, i}}];
+    using T = typename __combined<typename E::dtype, typename F::dtype>::type;
+    types::ndarray<T, 1> out(types::array<long, 1>{{f.shape()[1]}},
+                             __builtin__::None);
+    utils::gevm(out.buffer, e, f, f.shape()[0], f.shape()[1]);
     return out;
   }
 
-  // If one of the arg doesn't have a "blas compatible type", we use a slow
-  // matrix vector multiplication.
+  // If one of the arg doesn't have a "blas compatible type", we use our own
+  // packed matrix vector multiplication.
   template <class E, class F>
   typename std::enable_if<
       (!is_blas_type<typename E::dtype>::value ||
@@ -193,12 +351,10 @@ namespace numpy
           1>>::type
   dot(E const &e, F const &f)
   {
-    types::ndarray<
-        typename __combined<typename E::dtype, typename F::dtype>::type, 1>
-    out(types::array<long, 1>{{e.shape()[0]}}, 0);
-    for (long i = 0; i < out.shape()[0]; i++)
-      for (long j = 0; j < f.shape()[0]; j++)
-        out[i] += e[types::array<long, 2>{{i, j}}] * f[j];
+    using T = typename __combined<typename E::dtype, typename F::dtype>::type;
+    types::ndarray<T, 1> out(types::array<long, 1>{{e.shape()[0]}},
+                             __builtin__::None);
+    utils::gemv(out.buffer, e, f, e.shape()[0], e.shape()[1]);
     return out;
   }
 
@@ -342,8 +498,8 @@ namespace numpy
     return out;
   }
 
-  // If arguments could be use with blas, we evaluate them as we need pointer
-  // on array for blas
+  // If arguments could be use with blas, we pass strided views of arrays as
+  // is and evaluate the other ones, as we need pointer on array for blas
   template <class E, class F>
   typename std::enable_if<
       types::is_numexpr_arg<E>::value &&
@@ -359,17 +515,18 @@ namespace numpy
           2>>::type
   dot(E const &e, F const &f)
   {
-    types::ndarray<
-        typename __combined<typename E::dtype, typename F::dtype>::type, 2> e_ =
-        e;
-    types::ndarray<
-        typename __combined<typename E::dtype, typename F::dtype>::type, 2> f_ =
-        f;
-    return dot(e_, f_);
+    using T = typename __combined<typename E::dtype, typename F::dtype>::type;
+    types::ndarray<T, 2> e_, f_;
+    auto a = details::make_blas_operand(e, e_);
+    auto b = details::make_blas_operand(f, f_);
+    int m = e.shape()[0], n = f.shape()[1], k = e.shape()[1];
+    types::ndarray<T, 2> out(types::array<long, 2>{{m, n}}, __builtin__::None);
+    gemm(a, b, m, n, k, out.buffer);
+    return out;
   }
 
-  // If one of the arg doesn't have a "blas compatible type", we use a slow
-  // matrix multiplication.
+  // If one of the arg doesn't have a "blas compatible type", we use our own
+  // packed matrix multiplication.
   template <class E, class F>
   typename std::enable_if<
       (!is_blas_type<typename E::dtype>::value ||
@@ -380,15 +537,11 @@ namespace numpy
           2>>::type
   dot(E const &e, F const &f)
   {
-    types::ndarray<
-        typename __combined<typename E::dtype, typename F::dtype>::type, 2>
-    out(types::array<long, 2>{{e.shape()[0], f.shape()[1]}}, 0);
-    for (long i = 0; i < out.shape()[0]; i++)
-      for (long j = 0; j < out.shape()[1]; j++)
-        for (long k = 0; k < e.shape()[1]; k++)
-          out[types::array<long, 2>{{i, j}}] +=
-              e[types::array<long, 2>{{i, k}}] *
-              f[types::array<long, 2>{{k, j}}];
+    using T = typename __combined<typename E::dtype, typename F::dtype>::type;
+    types::ndarray<T, 2> out(
+        types::array<long, 2>{{e.shape()[0], f.shape()[1]}}, T());
+    utils::gemm<4, 8>(out.buffer, e, f, e.shape()[0], f.shape()[1],
+                      e.shape()[1]);
     return out;
   }
 
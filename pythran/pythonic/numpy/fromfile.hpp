@@ -0,0 +1,98 @@
+#ifndef PYTHONIC_NUMPY_FROMFILE_HPP
+#define PYTHONIC_NUMPY_FROMFILE_HPP
+
+#include "pythonic/include/numpy/fromfile.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/npy_format.hpp"
+#include "pythonic/numpy/fromstring.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/file.hpp"
+#include "pythonic/types/str.hpp"
+
+#include <cstdlib>
+#include <fcntl.h>
+#include <limits>
+#include <new>
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    // read ``count'' items, or up to the end of the file if negative
+    template <class T>
+    types::ndarray<T, 1> read_items(utils::file_descriptor const &fd,
+                                    long count)
+    {
+      long const size = fd.size();
+      if (size >= 0) {
+        // regular files are read at once, into the final buffer
+        long const available = size / sizeof(T);
+        types::array<long, 1> shape = {
+            count < 0 ? available : std::min(count, available)};
+        utils::shared_ref<types::raw_array<T>> buffer(shape[0]);
+        shape[0] = fd.read((char *)buffer->data, shape[0] * sizeof(T)) /
+                   sizeof(T);
+        return {buffer, shape};
+      }
+      // anything else is read until the end, doubling the buffer
+      if (count < 0)
+        count = std::numeric_limits<long>::max() / sizeof(T);
+      long capacity = 0, n = 0;
+      T *data = nullptr;
+      while (n < count) {
+        if (n == capacity) {
+          capacity = std::min(count, std::max(capacity * 2, 1L << 12));
+          T *grown = (T *)realloc(data, capacity * sizeof(T));
+          if (!grown) {
+            free(data);
+            throw std::bad_alloc();
+          }
+          data = grown;
+        }
+        size_t const chunk = (capacity - n) * sizeof(T);
+        size_t const got = fd.read((char *)(data + n), chunk);
+        n += got / sizeof(T);
+        // reads only come short at the end of the file
+        if (got < chunk)
+          break;
+      }
+      return {data, &n, types::ownership::owned};
+    }
+  }
+
+  template <class dtype>
+  types::ndarray<typename dtype::type, 1>
+  fromfile(types::str const &file, dtype d, long count, types::str const &sep)
+  {
+    if (sep)
+      return fromfile(types::file(file), d, count, sep);
+    return details::read_items<typename dtype::type>(
+        utils::file_descriptor(file, O_RDONLY), count);
+  }
+
+  template <class dtype>
+  types::ndarray<typename dtype::type, 1>
+  fromfile(types::file &file, dtype d, long count, types::str const &sep)
+  {
+    if (sep)
+      return fromstring(file.read(), d, count, sep);
+    types::str const bytes =
+        file.read(count < 0 ? -1 : count * sizeof(typename dtype::type));
+    return fromstring(bytes, d, -1, sep);
+  }
+
+  template <class dtype>
+  types::ndarray<typename dtype::type, 1>
+  fromfile(types::file &&file, dtype d, long count, types::str const &sep)
+  {
+    return fromfile(file, d, count, sep);
+  }
+
+  DEFINE_FUNCTOR(pythonic::numpy, fromfile);
+}
+PYTHONIC_NS_END
+
+#endif
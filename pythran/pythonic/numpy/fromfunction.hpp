@@ -7,6 +7,7 @@
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/__builtin__/None.hpp"
 #include "pythonic/utils/tags.hpp"
+#include "pythonic/utils/openmp.hpp"
 
 PYTHONIC_NS_BEGIN
 
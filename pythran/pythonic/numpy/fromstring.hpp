@@ -6,7 +6,10 @@
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/types/list.hpp"
+#include "pythonic/__builtin__/ValueError.hpp"
 
+#include <cctype>
+#include <cstring>
 #include <limits>
 #include <sstream>
 
@@ -14,6 +17,23 @@ PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
+  namespace details
+  {
+    // skip ``sep'' in ``is'', whose whitespace matches any run of whitespace,
+    // even an empty one, as numpy does
+    bool skip_separator(std::istream &is, types::str const &sep)
+    {
+      for (char const *c = sep.chars(), *end = c + sep.size(); c != end; ++c)
+        if (std::isspace((unsigned char)*c))
+          is >> std::ws;
+        else if (is.peek() == (unsigned char)*c)
+          is.get();
+        else
+          return false;
+      return true;
+    }
+  }
+
   template <class dtype>
   types::ndarray<typename dtype::type, 1> fromstring(types::str const &string,
                                                      dtype d, long count,
@@ -25,28 +45,25 @@ namespace numpy
         count = std::numeric_limits<long>::max();
       else
         res.reserve(count);
-      size_t current;
-      size_t next = -1;
-      long numsplit = 0;
-      do {
-        current = next + 1;
-        next = string.find_first_of(sep, current);
-        typename dtype::type item;
-        std::istringstream iss(
-            string.substr(current, next - current).get_data());
-        iss >> item;
+      // items are read up to the first one not followed by the separator
+      std::istringstream iss(string.get_data());
+      typename dtype::type item;
+      for (long n = 0; n < count && iss >> item; ++n) {
         res.push_back(item);
-      } while (next != types::str::npos && ++numsplit < count);
+        if (!details::skip_separator(iss, sep))
+          break;
+      }
       return {res};
     } else {
+      using T = typename dtype::type;
+      long const available = string.size() / sizeof(T);
       if (count < 0)
-        count = string.size();
+        count = available;
+      else if (count > available)
+        throw types::ValueError("string is smaller than requested size");
       types::array<long, 1> shape = {count};
-      utils::shared_ref<types::raw_array<typename dtype::type>> buffer(
-          shape[0]);
-      auto const *tstring =
-          reinterpret_cast<typename dtype::type const *>(string.c_str());
-      std::copy(tstring, tstring + shape[0], buffer->data);
+      utils::shared_ref<types::raw_array<T>> buffer(shape[0]);
+      memcpy(buffer->data, string.chars(), shape[0] * sizeof(T));
       return {buffer, shape};
     }
   }
@@ -7,9 +7,9 @@
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/types/combined.hpp"
 #include "pythonic/numpy/asarray.hpp"
+#include "pythonic/numpy/unique.hpp"
 
 #include <algorithm>
-#include <set>
 
 PYTHONIC_NS_BEGIN
 
@@ -23,19 +23,19 @@ namespace numpy
     using T = typename __combined<typename E::dtype, typename F::dtype>::type;
     auto ae = asarray(e);
     auto af = asarray(f);
-    std::set<T> sae(ae.fbegin(), ae.fend());
-    std::set<T> found;
-    types::list<T> lout(0);
-    lout.reserve(sae.size());
-    for (auto iter = af.fbegin(), end = af.fend(); iter != end; ++iter) {
-      auto curr = *iter;
-      if (sae.find(curr) != sae.end() && found.find(curr) == found.end()) {
-        found.insert(curr);
-        lout.push_back(curr);
-      }
-    }
-    std::sort(lout.begin(), lout.end());
-    return types::ndarray<T, 1>(lout);
+    types::ndarray<T, 1> ve(types::array<long, 1>{{ae.flat_size()}},
+                            __builtin__::None);
+    std::copy(ae.fbegin(), ae.fend(), ve.buffer);
+    types::ndarray<T, 1> vf(types::array<long, 1>{{af.flat_size()}},
+                            __builtin__::None);
+    std::copy(af.fbegin(), af.fend(), vf.buffer);
+    // both sets of distinct values are sorted, so they merge linearly
+    auto ue = details::unique_values(ve);
+    auto uf = details::unique_values(vf);
+    T *last = std::set_intersection(ue.buffer, ue.buffer + ue.flat_size(),
+                                    uf.buffer, uf.buffer + uf.flat_size(),
+                                    ve.buffer, _comp<T>{});
+    return details::unique_prefix(ve.buffer, last - ve.buffer);
   }
 
   DEFINE_FUNCTOR(pythonic::numpy, intersect1d);
@@ -4,34 +4,121 @@
 #include "pythonic/include/numpy/median.hpp"
 
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/for_each_lane.hpp"
+#include "pythonic/utils/int_.hpp"
 #include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/NoneType.hpp"
 #include "pythonic/numpy/asarray.hpp"
+#include "pythonic/numpy/partition.hpp"
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
+  namespace details
+  {
+    template <class T>
+    typename std::enable_if<!std::is_floating_point<T>::value, bool>::type
+    has_nan(T const *first, T const *last)
+    {
+      return false;
+    }
+
+    template <class T>
+    typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+    has_nan(T const *first, T const *last)
+    {
+      return std::any_of(first, last, [](T v) { return std::isnan(v); });
+    }
+
+    /* Median of the elements in [first, last), which are reordered in the
+     * process. Selection is linear, while sorting would ! be.
+     */
+    template <class T>
+    median_type<T> median_lane(T *first, T *last)
+    {
+      using R = median_type<T>;
+      long const n = last - first;
+      if (n == 0 || has_nan(first, last))
+        return std::numeric_limits<R>::quiet_NaN();
+      T *middle = first + n / 2;
+      std::nth_element(first, middle, last, _comp<T>{});
+      if (n % 2)
+        return *middle;
+      // the other middle element is the largest of the lower half
+      return (R(*middle) + R(*std::max_element(first, middle, _comp<T>{}))) /
+             double(2);
+    }
+
+    /* Reduce each lane of ``a'' along ``axis'' to the value computed by
+     * ``f'' from its elements.
+     */
+    template <class T, size_t N, class F>
+    auto reduce_lanes(types::ndarray<T, N> &a, long axis, F const &f)
+        -> types::ndarray<decltype(f(a.buffer, a.buffer)), N - 1>
+    {
+      using R = decltype(f(a.buffer, a.buffer));
+      auto &&shape = a.shape();
+      types::array<long, N - 1> shp;
+      auto next = std::copy(shape.begin(), shape.begin() + axis, shp.begin());
+      std::copy(shape.begin() + axis + 1, shape.end(), next);
+      types::ndarray<R, N - 1> out{shp, __builtin__::None};
+      R *obuf = out.buffer;
+      if (shape[axis] == 0)
+        std::fill(obuf, obuf + out.flat_size(), f(a.buffer, a.buffer));
+      else
+        utils::for_each_lane(a, axis, [obuf, f](T *first, T *last,
+                                                long lane) {
+          obuf[lane] = f(first, last);
+        });
+      return out;
+    }
+
+    template <class T>
+    median_type<T> median_axis(types::ndarray<T, 1> &arr, long axis,
+                               utils::int_<1>)
+    {
+      return median_lane(arr.buffer, arr.buffer + arr.flat_size());
+    }
+
+    template <class T, size_t N>
+    types::ndarray<median_type<T>, N - 1>
+    median_axis(types::ndarray<T, N> &arr, long axis, utils::int_<N>)
+    {
+      return reduce_lanes(arr, axis, median_lane<T>);
+    }
+  }
+
+  template <class T, size_t N>
+  details::median_type<T> median(types::ndarray<T, N> const &arr,
+                                 types::none_type axis)
+  {
+    return median(arr.copy(), axis);
+  }
+
+  template <class T, size_t N>
+  details::median_type<T> median(types::ndarray<T, N> &&arr,
+                                 types::none_type)
+  {
+    return details::median_lane(arr.buffer, arr.buffer + arr.flat_size());
+  }
+
   template <class T, size_t N>
-  decltype(std::declval<T>() + 1.) median(types::ndarray<T, N> const &arr)
+  details::median_axis_type<T, N> median(types::ndarray<T, N> const &arr,
+                                         long axis)
   {
-    size_t n = arr.flat_size();
-    T *tmp = new T[n];
-    std::copy(arr.buffer, arr.buffer + n, tmp);
-    std::sort(tmp, tmp + n);
-    auto out = (tmp[n / 2] + tmp[(n - 1) / 2]) / double(2);
-    delete[] tmp;
-    return out;
+    return median(arr.copy(), axis);
   }
 
   template <class T, size_t N>
-  decltype(std::declval<T>() + 1.) median(types::ndarray<T, N> &&arr)
+  details::median_axis_type<T, N> median(types::ndarray<T, N> &&arr,
+                                         long axis)
   {
-    size_t n = arr.flat_size();
-    T *tmp = arr.buffer;
-    std::sort(tmp, tmp + n);
-    auto out = (tmp[n / 2] + tmp[(n - 1) / 2]) / double(2);
-    return out;
+    return details::median_axis(arr, details::normalize_axis(axis, N),
+                                utils::int_<N>());
   }
 
   NUMPY_EXPR_TO_NDARRAY0_IMPL(median);
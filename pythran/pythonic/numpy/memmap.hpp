@@ -0,0 +1,116 @@
+#ifndef PYTHONIC_NUMPY_MEMMAP_HPP
+#define PYTHONIC_NUMPY_MEMMAP_HPP
+
+#include "pythonic/include/numpy/memmap.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/npy_format.hpp"
+#include "pythonic/numpy/uint8.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/NoneType.hpp"
+#include "pythonic/types/str.hpp"
+#include "pythonic/__builtin__/IOError.hpp"
+#include "pythonic/__builtin__/ValueError.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <functional>
+#include <numeric>
+#include <sys/mman.h>
+#include <unistd.h>
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    // release the ``length'' bytes mapped by ``map_file'' around ``data''
+    template <class T>
+    void unmap_file(T *data, size_t length)
+    {
+      // mappings start on a page boundary
+      uintptr_t const page = sysconf(_SC_PAGESIZE);
+      munmap(reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(data) /
+                                      page * page),
+             length);
+    }
+
+    // map ``count'' items from ``offset'', or up to the end if negative
+    template <class T>
+    utils::shared_ref<types::raw_array<T>>
+    map_file(types::str const &filename, types::str const &mode, long offset,
+             long &count)
+    {
+      bool const shared = mode == "r+", read_only = mode == "r";
+      if (!shared && !read_only && mode != "c")
+        throw types::ValueError("mode must be one of 'r', 'c' or 'r+'");
+      utils::file_descriptor fd(filename, shared ? O_RDWR : O_RDONLY);
+      long const size = fd.size();
+      if (size < 0)
+        throw types::ValueError("cannot map " + filename);
+      if (offset < 0 || offset > size)
+        throw types::ValueError("offset is out of the file");
+      // pages are aligned, so the items are if the offset is
+      if (offset % alignof(T))
+        throw types::ValueError("offset is not aligned for the dtype");
+      if (count < 0)
+        count = (size - offset) / sizeof(T);
+      else if (count > (long)((size - offset) / sizeof(T)))
+        throw types::ValueError("mmap length is greater than file size");
+      if (count == 0)
+        return {nullptr, types::ownership::owned};
+
+      // mappings start on a page boundary
+      long const page = sysconf(_SC_PAGESIZE);
+      long const start = offset / page * page;
+      size_t const length = offset - start + count * sizeof(T);
+      void *base =
+          mmap(nullptr, length, read_only ? PROT_READ : PROT_READ | PROT_WRITE,
+               shared ? MAP_SHARED : MAP_PRIVATE, fd.fd, start);
+      if (base == MAP_FAILED)
+        throw types::IOError(strerror(errno));
+      return {reinterpret_cast<T *>(static_cast<char *>(base) + offset - start),
+              length, read_only ? types::ownership::mapped_read_only
+                                : types::ownership::mapped,
+              &unmap_file<T>};
+    }
+  }
+
+  template <class dtype>
+  types::ndarray<typename dtype::type, 1>
+  memmap(types::str const &filename, dtype d, types::str const &mode,
+         long offset, types::none_type shape)
+  {
+    return memmap(filename, d, mode, offset, -1L);
+  }
+
+  template <class dtype>
+  types::ndarray<typename dtype::type, 1>
+  memmap(types::str const &filename, dtype d, types::str const &mode,
+         long offset, long shape)
+  {
+    auto mem =
+        details::map_file<typename dtype::type>(filename, mode, offset, shape);
+    return {mem, types::array<long, 1>{{shape}}};
+  }
+
+  template <class dtype, class IntTy, size_t N>
+  types::ndarray<typename dtype::type, N>
+  memmap(types::str const &filename, dtype d, types::str const &mode,
+         long offset, types::array<IntTy, N> const &shape)
+  {
+    long count = std::accumulate(shape.begin(), shape.end(), 1L,
+                                 std::multiplies<long>());
+    auto mem =
+        details::map_file<typename dtype::type>(filename, mode, offset, count);
+    return {mem, types::array<long, N>(shape)};
+  }
+
+  DEFINE_FUNCTOR(pythonic::numpy, memmap);
+}
+PYTHONIC_NS_END
+
+#endif
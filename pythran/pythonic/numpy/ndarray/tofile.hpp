@@ -0,0 +1,128 @@
+#ifndef PYTHONIC_NUMPY_NDARRAY_TOFILE_HPP
+#define PYTHONIC_NUMPY_NDARRAY_TOFILE_HPP
+
+#include "pythonic/include/numpy/ndarray/tofile.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/npy_format.hpp"
+#include "pythonic/utils/numpy_conversion.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/file.hpp"
+#include "pythonic/types/str.hpp"
+#include "pythonic/__builtin__/None.hpp"
+
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <limits>
+#include <sstream>
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+
+  namespace ndarray
+  {
+    namespace details
+    {
+      template <class T>
+      void write_item(std::ostream &os, T value)
+      {
+        // promoted, so that 8 bits integers are not written as characters
+        os << +value;
+      }
+
+      inline void write_item(std::ostream &os, bool value)
+      {
+        os << (value ? "True" : "False");
+      }
+
+      // the shortest of the two usual precisions that reads back exactly
+      template <class F>
+      void write_float(std::ostream &os, F value)
+      {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%.*g",
+                 std::numeric_limits<F>::digits10, (double)value);
+        if ((F)strtod(buffer, nullptr) != value)
+          snprintf(buffer, sizeof(buffer), "%.*g",
+                   std::numeric_limits<F>::max_digits10, (double)value);
+        os << buffer;
+      }
+
+      inline void write_item(std::ostream &os, float value)
+      {
+        write_float(os, value);
+      }
+
+      inline void write_item(std::ostream &os, double value)
+      {
+        write_float(os, value);
+      }
+
+      template <class T>
+      void write_item(std::ostream &os, std::complex<T> const &value)
+      {
+        os << '(';
+        write_float(os, value.real());
+        if (!(value.imag() < 0))
+          os << '+';
+        write_float(os, value.imag());
+        os << "j)";
+      }
+
+      template <class T, size_t N>
+      types::str to_text(types::ndarray<T, N> const &expr,
+                         types::str const &sep)
+      {
+        std::ostringstream oss;
+        T const *data = expr.buffer;
+        for (long i = 0, n = expr.flat_size(); i < n; ++i) {
+          if (i)
+            oss << sep;
+          write_item(oss, data[i]);
+        }
+        return oss.str();
+      }
+    }
+
+    template <class T, size_t N>
+    types::none_type tofile(types::ndarray<T, N> const &expr,
+                            types::str const &file, types::str const &sep)
+    {
+      if (sep)
+        return tofile(expr, types::file(file, "w"), sep);
+      utils::file_descriptor(file, O_WRONLY | O_CREAT | O_TRUNC)
+          .write(reinterpret_cast<char const *>(expr.buffer),
+                 expr.flat_size() * sizeof(T));
+      return __builtin__::None;
+    }
+
+    template <class T, size_t N>
+    types::none_type tofile(types::ndarray<T, N> const &expr,
+                            types::file &file, types::str const &sep)
+    {
+      if (sep)
+        file.write(details::to_text(expr, sep));
+      else
+        file.write(types::str(reinterpret_cast<char const *>(expr.buffer),
+                              expr.flat_size() * sizeof(T)));
+      return __builtin__::None;
+    }
+
+    template <class T, size_t N>
+    types::none_type tofile(types::ndarray<T, N> const &expr,
+                            types::file &&file, types::str const &sep)
+    {
+      return tofile(expr, file, sep);
+    }
+
+    NUMPY_EXPR_TO_NDARRAY0_IMPL(tofile);
+    DEFINE_FUNCTOR(pythonic::numpy::ndarray, tofile);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
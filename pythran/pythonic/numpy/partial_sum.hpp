@@ -3,6 +3,7 @@
 
 #include "pythonic/include/numpy/partial_sum.hpp"
 
+#include "pythonic/utils/prefix_scan.hpp"
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/__builtin__/ValueError.hpp"
 
@@ -22,65 +23,35 @@ namespace numpy
    */
   namespace
   {
+    // arrays are scanned from their own buffer
+    template <class Op, class A, class T, size_t N>
+    types::ndarray<A, N> _partial_sum(types::ndarray<T, N> const &values,
+                                      long outer, long n, long inner)
+    {
+      types::ndarray<A, N> the_partial_sum{values.shape(), __builtin__::None};
+      utils::inclusive_scan<Op>(values.buffer, the_partial_sum.buffer, outer,
+                                n, inner);
+      return the_partial_sum;
+    }
 
-    template <class Op, size_t N, class A>
-    struct _partial_sum {
-      template <class E, class F>
-      A operator()(E e, F &o)
-      {
-        auto it_begin = e.begin();
-        A acc = _partial_sum<Op, N - 1, A>{}((*it_begin), o);
-        ++it_begin;
-        for (; it_begin < e.end(); ++it_begin)
-          acc = _partial_sum<Op, N - 1, A>{}(*it_begin, o, acc);
-        return acc;
-      }
-      template <class E, class F>
-      A operator()(E e, F &o, A acc)
-      {
-        for (auto const &value : e)
-          acc = _partial_sum<Op, N - 1, A>{}(value, o, acc);
-        return acc;
-      }
-    };
-
-    template <class Op, class A>
-    struct _partial_sum<Op, 1, A> {
-      template <class E, class F>
-      A operator()(E e, F &o)
-      {
-        auto it_begin = e.begin();
-        A acc = *it_begin;
-        *o = acc;
-        ++it_begin, ++o;
-        for (; it_begin < e.end(); ++it_begin, ++o) {
-          acc = Op{}(acc, (A)*it_begin);
-          *o = acc;
-        }
-        return acc;
-      }
-      template <class E, class F>
-      A operator()(E e, F &o, A acc)
-      {
-        for (auto const &value : e) {
-          acc = Op{}(acc, (A)value);
-          *o = acc;
-          ++o;
-        }
-        return acc;
-      }
-    };
+    // values are converted before being combined, so other expressions are
+    // evaluated in the result, then scanned in place
+    template <class Op, class A, class E>
+    types::ndarray<A, E::value> _partial_sum(E const &expr, long outer, long n,
+                                             long inner)
+    {
+      types::ndarray<A, E::value> the_partial_sum{expr};
+      utils::inclusive_scan<Op>(the_partial_sum.buffer,
+                                the_partial_sum.buffer, outer, n, inner);
+      return the_partial_sum;
+    }
   }
 
   template <class Op, class E, class dtype>
   types::ndarray<typename dtype::type, 1> partial_sum(E const &expr, dtype d)
   {
     const long count = expr.flat_size();
-    types::ndarray<typename dtype::type, 1> the_partial_sum{
-        types::make_tuple(count), __builtin__::None};
-    auto begin_it = the_partial_sum.begin();
-    _partial_sum<Op, E::value, typename dtype::type>{}(expr, begin_it);
-    return the_partial_sum;
+    return _partial_sum<Op, typename dtype::type>(expr, 1, count, 1).flat();
   }
 
   template <class Op, class E, class dtype>
@@ -101,17 +72,13 @@ namespace numpy
       throw types::ValueError("axis out of bounds");
 
     auto shape = expr.shape();
-    partial_sum_type<Op, E, dtype> the_partial_sum{shape, __builtin__::None};
-    if (axis == 0) {
-      auto it_begin = the_partial_sum.begin();
-      _partial_sum<Op, 1, partial_sum_type2<Op, E, dtype>>{}(expr, it_begin);
-    } else {
-      std::transform(expr.begin(), expr.end(), the_partial_sum.begin(),
-                     [axis, d](typename E::iterator::value_type other) {
-                       return partial_sum<Op>(other, axis - 1, d);
-                     });
-    }
-    return the_partial_sum;
+    long outer = 1, inner = 1;
+    for (long i = 0; i < axis; ++i)
+      outer *= shape[i];
+    for (size_t i = axis + 1; i < E::value; ++i)
+      inner *= shape[i];
+    return _partial_sum<Op, typename dtype::type>(expr, outer, shape[axis],
+                                                  inner);
   }
 }
 PYTHONIC_NS_END
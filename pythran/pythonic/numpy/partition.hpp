@@ -0,0 +1,103 @@
+#ifndef PYTHONIC_NUMPY_PARTITION_HPP
+#define PYTHONIC_NUMPY_PARTITION_HPP
+
+#include "pythonic/include/numpy/partition.hpp"
+
+#include <algorithm>
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/for_each_lane.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/NoneType.hpp"
+#include "pythonic/numpy/sort.hpp"
+#include "pythonic/__builtin__/ValueError.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    long normalize_axis(long axis, size_t N)
+    {
+      if (axis < 0)
+        axis += N;
+      if (axis < 0 || size_t(axis) >= N)
+        throw types::ValueError("axis out of bounds");
+      return axis;
+    }
+
+    template <class K>
+    typename std::enable_if<std::is_integral<K>::value,
+                            std::vector<long>>::type
+    normalize_kth(K kth, long n)
+    {
+      return normalize_kth(std::vector<long>(1, kth), n);
+    }
+
+    // sorted, unique, positive kth
+    template <class K>
+    typename std::enable_if<!std::is_integral<K>::value,
+                            std::vector<long>>::type
+    normalize_kth(K const &kth, long n)
+    {
+      std::vector<long> out(kth.begin(), kth.end());
+      for (long &k : out) {
+        if (k < 0)
+          k += n;
+        if (k < 0 || k >= n)
+          throw types::ValueError("kth out of bounds");
+      }
+      std::sort(out.begin(), out.end());
+      out.erase(std::unique(out.begin(), out.end()), out.end());
+      return out;
+    }
+
+    /* Introselect each kth element in turn, each selection only working on
+     * the elements on the right of the previous one.
+     */
+    template <class Iterator, class Comp>
+    void partition_lane(Iterator first, Iterator last,
+                        std::vector<long> const &kth, Comp const &comp)
+    {
+      Iterator begin = first;
+      for (long k : kth) {
+        std::nth_element(begin, first + k, last, comp);
+        begin = first + k + 1;
+      }
+    }
+  }
+
+  template <class T, size_t N, class K>
+  types::ndarray<T, N> partition(types::ndarray<T, N> const &a, K const &kth,
+                                 long axis)
+  {
+    return partition(a.copy(), kth, axis);
+  }
+
+  template <class T, size_t N, class K>
+  types::ndarray<T, N> partition(types::ndarray<T, N> &&a, K const &kth,
+                                 long axis)
+  {
+    axis = details::normalize_axis(axis, N);
+    std::vector<long> kths = details::normalize_kth(kth, a.shape()[axis]);
+    utils::for_each_lane(a, axis, [&kths](T *first, T *last, long) {
+      details::partition_lane(first, last, kths, _comp<T>{});
+    });
+    return a;
+  }
+
+  template <class T, size_t N, class K>
+  types::ndarray<T, 1> partition(types::ndarray<T, N> const &a, K const &kth,
+                                 types::none_type)
+  {
+    return partition(a.flat().copy(), kth, 0);
+  }
+
+  NUMPY_EXPR_TO_NDARRAY0_IMPL(partition);
+
+  DEFINE_FUNCTOR(pythonic::numpy, partition);
+}
+PYTHONIC_NS_END
+
+#endif
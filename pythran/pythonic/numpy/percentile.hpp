@@ -0,0 +1,36 @@
+#ifndef PYTHONIC_NUMPY_PERCENTILE_HPP
+#define PYTHONIC_NUMPY_PERCENTILE_HPP
+
+#include "pythonic/include/numpy/percentile.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/NoneType.hpp"
+#include "pythonic/numpy/quantile.hpp"
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class T, size_t N, class Q, class Axis>
+  typename details::quantile_result<T, N, Q, Axis>::type
+  percentile(types::ndarray<T, N> const &a, Q const &q, Axis axis)
+  {
+    return percentile(a.copy(), q, axis);
+  }
+
+  template <class T, size_t N, class Q, class Axis>
+  typename details::quantile_result<T, N, Q, Axis>::type
+  percentile(types::ndarray<T, N> &&a, Q const &q, Axis axis)
+  {
+    return details::quantile(a, q, axis, 100.,
+                             "Percentiles must be in the range [0, 100]");
+  }
+
+  NUMPY_EXPR_TO_NDARRAY0_IMPL(percentile);
+
+  DEFINE_FUNCTOR(pythonic::numpy, percentile);
+}
+PYTHONIC_NS_END
+
+#endif
@@ -7,6 +7,7 @@
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/numpy/asarray.hpp"
 #include "pythonic/utils/numpy_conversion.hpp"
+#include "pythonic/utils/gather_scatter.hpp"
 #include "pythonic/__builtin__/ValueError.hpp"
 
 PYTHONIC_NS_BEGIN
@@ -20,12 +21,15 @@ namespace numpy
   {
     auto vind = asarray(ind);
     auto vv = asarray(v);
-    for (long i = 0; i < ind.flat_size(); ++i) {
-      auto val = *(vind.fbegin() + i);
-      if (val >= expr.flat_size() || val < 0)
-        throw types::ValueError("indice out of bound");
-      *(expr.fbegin() + val) = *(vv.fbegin() + i % vv.flat_size());
-    }
+    long const size = expr.flat_size(), n = vind.flat_size();
+    // no early exit, so that the check vectorizes
+    bool out_of_bound = false;
+    for (long i = 0; i < n; ++i)
+      out_of_bound |= (vind.buffer[i] >= size) | (vind.buffer[i] < 0);
+    if (out_of_bound)
+      throw types::ValueError("indice out of bound");
+    utils::scatter(expr.buffer, size, 1, vind.buffer, n, vv.buffer,
+                   vv.flat_size());
     return __builtin__::None;
   }
 
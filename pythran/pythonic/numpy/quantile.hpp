@@ -0,0 +1,180 @@
+#ifndef PYTHONIC_NUMPY_QUANTILE_HPP
+#define PYTHONIC_NUMPY_QUANTILE_HPP
+
+#include "pythonic/include/numpy/quantile.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/for_each_lane.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/NoneType.hpp"
+#include "pythonic/numpy/median.hpp"
+#include "pythonic/numpy/partition.hpp"
+#include "pythonic/__builtin__/ValueError.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  namespace details
+  {
+    using quantile_positions = std::vector<std::pair<double, long>>;
+
+    /* Fractions of the quantiles ``q'' expressed in ``[0, scale]'', along
+     * with their index in ``q'', in increasing order.
+     */
+    template <class Q>
+    typename std::enable_if<!std::is_arithmetic<Q>::value,
+                            quantile_positions>::type
+    make_quantile_positions(Q const &q, double scale, char const *error)
+    {
+      quantile_positions positions;
+      for (double v : q) {
+        if (!(0 <= v && v <= scale))
+          throw types::ValueError(error);
+        positions.emplace_back(v / scale, positions.size());
+      }
+      std::sort(positions.begin(), positions.end());
+      return positions;
+    }
+
+    template <class Q>
+    typename std::enable_if<std::is_arithmetic<Q>::value,
+                            quantile_positions>::type
+    make_quantile_positions(Q q, double scale, char const *error)
+    {
+      return make_quantile_positions(std::vector<double>(1, q), scale, error);
+    }
+
+    /* Linearly interpolated quantiles of the elements in [first, last),
+     * which are reordered in the process. The value of the quantile of index
+     * ``i'' is stored in ``out[i * out_stride]''.
+     *
+     * Each quantile is found through a selection on the elements that are
+     * not below the previous one, then its right neighbour is the smallest
+     * element of the remaining ones.
+     */
+    template <class T, class R>
+    void quantile_lane(T *first, T *last, quantile_positions const &positions,
+                       R *out, long out_stride)
+    {
+      long const n = last - first;
+      if (n == 0 || has_nan(first, last)) {
+        for (auto const &position : positions)
+          out[position.second * out_stride] =
+              std::numeric_limits<R>::quiet_NaN();
+        return;
+      }
+      T *begin = first;
+      for (auto const &position : positions) {
+        double const index = position.first * (n - 1);
+        long const lo = std::floor(index);
+        double const t = index - lo;
+        std::nth_element(begin, first + lo, last, _comp<T>{});
+        R const below = first[lo];
+        R value = below;
+        if (t > 0) {
+          R const above = *std::min_element(first + lo + 1, last, _comp<T>{});
+          R const diff = above - below;
+          // same interpolation as numpy, which is monotonic
+          value = t < .5 ? below + diff * t : above - diff * (1 - t);
+        }
+        out[position.second * out_stride] = value;
+        begin = first + lo;
+      }
+    }
+
+    template <class R, size_t N>
+    types::ndarray<R, N> quantile_as(types::ndarray<R, N> &&out,
+                                     std::false_type)
+    {
+      return out;
+    }
+
+    template <class R>
+    R quantile_as(types::ndarray<R, 1> &&out, std::true_type)
+    {
+      return out.buffer[0];
+    }
+
+    // drop the leading dimension of size one
+    template <class R, size_t N>
+    types::ndarray<R, N - 1> quantile_as(types::ndarray<R, N> &&out,
+                                         std::true_type)
+    {
+      auto &&shape = out.shape();
+      types::array<long, N - 1> shp;
+      std::copy(shape.begin() + 1, shape.end(), shp.begin());
+      return std::move(out).reshape(shp);
+    }
+
+    template <class T, size_t N, class Q>
+    typename quantile_result<T, N, Q, types::none_type>::type
+    quantile(types::ndarray<T, N> &a, Q const &q, types::none_type,
+             double scale, char const *error)
+    {
+      using R = median_type<T>;
+      quantile_positions positions = make_quantile_positions(q, scale, error);
+      types::ndarray<R, 1> out{types::array<long, 1>{{long(positions.size())}},
+                               __builtin__::None};
+      quantile_lane(a.buffer, a.buffer + a.flat_size(), positions, out.buffer,
+                    1);
+      return quantile_as(std::move(out), std::is_arithmetic<Q>());
+    }
+
+    template <class T, size_t N, class Q>
+    typename quantile_result<T, N, Q, long>::type
+    quantile(types::ndarray<T, N> &a, Q const &q, long axis, double scale,
+             char const *error)
+    {
+      using R = median_type<T>;
+      axis = normalize_axis(axis, N);
+      quantile_positions positions = make_quantile_positions(q, scale, error);
+      auto &&shape = a.shape();
+      types::array<long, N> shp;
+      shp[0] = positions.size();
+      auto next =
+          std::copy(shape.begin(), shape.begin() + axis, shp.begin() + 1);
+      std::copy(shape.begin() + axis + 1, shape.end(), next);
+      types::ndarray<R, N> out{shp, __builtin__::None};
+      R *obuf = out.buffer;
+      long const nlanes = out.flat_size() / positions.size();
+      if (shape[axis] == 0)
+        std::fill(obuf, obuf + out.flat_size(),
+                  std::numeric_limits<R>::quiet_NaN());
+      else
+        utils::for_each_lane(a, axis, [&positions, obuf, nlanes](
+                                          T *first, T *last, long lane) {
+          quantile_lane(first, last, positions, obuf + lane, nlanes);
+        });
+      return quantile_as(std::move(out), std::is_arithmetic<Q>());
+    }
+  }
+
+  template <class T, size_t N, class Q, class Axis>
+  typename details::quantile_result<T, N, Q, Axis>::type
+  quantile(types::ndarray<T, N> const &a, Q const &q, Axis axis)
+  {
+    return quantile(a.copy(), q, axis);
+  }
+
+  template <class T, size_t N, class Q, class Axis>
+  typename details::quantile_result<T, N, Q, Axis>::type
+  quantile(types::ndarray<T, N> &&a, Q const &q, Axis axis)
+  {
+    return details::quantile(a, q, axis, 1.,
+                             "Quantiles must be in the range [0, 1]");
+  }
+
+  NUMPY_EXPR_TO_NDARRAY0_IMPL(quantile);
+
+  DEFINE_FUNCTOR(pythonic::numpy, quantile);
+}
+PYTHONIC_NS_END
+
+#endif
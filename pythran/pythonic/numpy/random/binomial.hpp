@@ -2,6 +2,7 @@
 #define PYTHONIC_NUMPY_RANDOM_BINOMIAL_HPP
 
 #include "pythonic/include/numpy/random/binomial.hpp"
+#include "pythonic/numpy/random/generator.hpp"
 
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/types/numpy_expr.hpp"
@@ -33,8 +34,14 @@ namespace numpy
       details::parameters_check(n, p);
       types::ndarray<long, N> result{shape, types::none_type()};
       std::binomial_distribution<long> distribution{(long)n, p};
-      std::generate(result.fbegin(), result.fend(),
-                    [&]() { return distribution(details::generator); });
+      details::parallel_fill(
+          result.buffer, result.flat_size(),
+          [&distribution](details::default_numpy_generator_t &engine,
+                          long *first, long count) {
+            auto local = distribution;
+            std::generate(first, first + count,
+                          [&]() { return local(engine); });
+          });
       return result;
     }
 
@@ -47,7 +54,8 @@ namespace numpy
     long binomial(double n, double p, types::none_type d)
     {
       details::parameters_check(n, p);
-      return std::binomial_distribution<long>{(long)n, p}(details::generator);
+      return std::binomial_distribution<long>{(long)n,
+                                              p}(details::generator());
     }
 
     DEFINE_FUNCTOR(pythonic::numpy::random, binomial);
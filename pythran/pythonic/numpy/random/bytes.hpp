@@ -2,7 +2,7 @@
 #define PYTHONIC_NUMPY_RANDOM_BYTES_HPP
 
 #include "pythonic/include/numpy/random/bytes.hpp"
-#include "pythonic/include/numpy/random/generator.hpp"
+#include "pythonic/numpy/random/generator.hpp"
 
 #include "pythonic/types/str.hpp"
 #include "pythonic/utils/functor.hpp"
@@ -22,7 +22,7 @@ namespace numpy
       types::str result(std::string(length, 0));
       std::uniform_int_distribution<long> distribution{0, 255};
       std::generate(result.begin(), result.end(), [&]() {
-        return static_cast<char>(distribution(details::generator));
+        return static_cast<char>(distribution(details::generator()));
       });
       return result;
     }
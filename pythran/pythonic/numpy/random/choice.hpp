@@ -2,7 +2,7 @@
 #define PYTHONIC_NUMPY_RANDOM_CHOICE_HPP
 
 #include "pythonic/include/numpy/random/choice.hpp"
-#include "pythonic/include/numpy/random/generator.hpp"
+#include "pythonic/numpy/random/generator.hpp"
 
 #include "pythonic/__builtin__/NotImplementedError.hpp"
 #include "pythonic/numpy/random/randint.hpp"
@@ -32,8 +32,14 @@ namespace numpy
 
       types::ndarray<long, S> result{shape, types::none_type()};
       std::discrete_distribution<long> distribution{p.begin(), p.end()};
-      std::generate(result.fbegin(), result.fend(),
-                    [&]() { return distribution(details::generator); });
+      details::parallel_fill(
+          result.buffer, result.flat_size(),
+          [&distribution](details::default_numpy_generator_t &engine,
+                          long *first, long count) {
+            auto local = distribution;
+            std::generate(first, first + count,
+                          [&]() { return local(engine); });
+          });
       return result;
     }
 
@@ -77,9 +83,15 @@ namespace numpy
       static_assert(T::value == 1, "ValueError: a must be 1-dimensional");
 
       types::ndarray<typename T::dtype, S> result{shape, types::none_type()};
-      std::uniform_int_distribution<long> distribution{0, a.size() - 1};
-      std::generate(result.fbegin(), result.fend(),
-                    [&]() { return a[distribution(details::generator)]; });
+      long const size = a.size();
+      details::parallel_fill(
+          result.buffer, result.flat_size(),
+          [&a, size](details::default_numpy_generator_t &engine,
+                     typename T::dtype *first, long count) {
+            std::generate(first, first + count, [&]() {
+              return a[details::integer(engine, 0, size)];
+            });
+          });
       return result;
     }
 
@@ -104,8 +116,14 @@ namespace numpy
 
       types::ndarray<typename T::dtype, S> result{shape, types::none_type()};
       std::discrete_distribution<long> distribution{p.begin(), p.end()};
-      std::generate(result.fbegin(), result.fend(),
-                    [&]() { return a[distribution(details::generator)]; });
+      details::parallel_fill(
+          result.buffer, result.flat_size(),
+          [&a, &distribution](details::default_numpy_generator_t &engine,
+                              typename T::dtype *first, long count) {
+            auto local = distribution;
+            std::generate(first, first + count,
+                          [&]() { return a[local(engine)]; });
+          });
       return result;
     }
 
@@ -0,0 +1,358 @@
+#ifndef PYTHONIC_NUMPY_RANDOM_GENERATOR_HPP
+#define PYTHONIC_NUMPY_RANDOM_GENERATOR_HPP
+
+#include "pythonic/include/numpy/random/generator.hpp"
+
+#include "pythonic/utils/unit_state.hpp"
+#include "pythonic/utils/openmp.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+PYTHONIC_NS_BEGIN
+namespace numpy
+{
+  namespace random
+  {
+    namespace details
+    {
+      namespace philox
+      {
+        static const uint32_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+        static const uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+        static const int rounds = 10;
+        // blocks computed side by side, so that the rounds vectorize
+        static const long lanes = 64;
+
+        inline void round(uint32_t &c0, uint32_t &c1, uint32_t &c2,
+                          uint32_t &c3, uint32_t k0, uint32_t k1)
+        {
+          uint64_t const p0 = (uint64_t)M0 * c0, p1 = (uint64_t)M1 * c2;
+          c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+          c1 = (uint32_t)p1;
+          c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+          c3 = (uint32_t)p0;
+        }
+
+        // block ``index'' of ``stream''
+        inline void block(uint64_t key, uint64_t stream, uint64_t index,
+                          uint32_t *out)
+        {
+          uint32_t c0 = (uint32_t)index, c1 = (uint32_t)(index >> 32),
+                   c2 = (uint32_t)stream, c3 = (uint32_t)(stream >> 32);
+          uint32_t k0 = (uint32_t)key, k1 = (uint32_t)(key >> 32);
+          for (int r = 0; r < rounds; ++r, k0 += W0, k1 += W1)
+            round(c0, c1, c2, c3, k0, k1);
+          out[0] = c0, out[1] = c1, out[2] = c2, out[3] = c3;
+        }
+
+        // blocks [index, index + lanes) of ``stream'', as 64 bits words
+        inline void blocks(uint64_t key, uint64_t stream, uint64_t index,
+                           uint64_t *out)
+        {
+          uint32_t c0[lanes], c1[lanes], c2[lanes], c3[lanes];
+          for (long l = 0; l < lanes; ++l) {
+            c0[l] = (uint32_t)(index + l);
+            c1[l] = (uint32_t)((index + l) >> 32);
+            c2[l] = (uint32_t)stream;
+            c3[l] = (uint32_t)(stream >> 32);
+          }
+          uint32_t k0 = (uint32_t)key, k1 = (uint32_t)(key >> 32);
+          for (int r = 0; r < rounds; ++r, k0 += W0, k1 += W1)
+            for (long l = 0; l < lanes; ++l)
+              round(c0[l], c1[l], c2[l], c3[l], k0, k1);
+          for (long l = 0; l < lanes; ++l) {
+            out[2 * l] = c0[l] | (uint64_t)c1[l] << 32;
+            out[2 * l + 1] = c2[l] | (uint64_t)c3[l] << 32;
+          }
+        }
+      }
+
+      philox_engine::philox_engine(uint64_t key, uint64_t stream)
+      {
+        seed(key, stream);
+      }
+
+      void philox_engine::seed(uint64_t key, uint64_t stream)
+      {
+        this->key = key;
+        this->stream = stream;
+        block = 0;
+        used = 4;
+      }
+
+      philox_engine::result_type philox_engine::operator()()
+      {
+        if (used == 4) {
+          philox::block(key, stream, block++, words);
+          used = 0;
+        }
+        return words[used++];
+      }
+
+      void philox_engine::discard(unsigned long long z)
+      {
+        for (; z && used < 4; --z)
+          ++used;
+        block += z / 4;
+        if (z % 4) {
+          philox::block(key, stream, block++, words);
+          used = z % 4;
+        }
+      }
+
+      void philox_engine::fill(uint64_t *out, long n)
+      {
+        uint64_t buffer[2 * philox::lanes];
+        used = 4;
+        for (long i = 0; i < n; i += 2 * philox::lanes) {
+          long const m = std::min(2 * philox::lanes, n - i);
+          philox::blocks(key, stream, block, buffer);
+          std::copy(buffer, buffer + m, out + i);
+          block += (m + 1) / 2;
+        }
+      }
+
+      uint64_t random_key()
+      {
+        std::random_device rd;
+        return (uint64_t)rd() << 32 | rd();
+      }
+
+      void seed(uint64_t key)
+      {
+        state.key = key;
+        state.streams = 0;
+        ++state.epoch;
+      }
+
+      // each translation unit of a module has its own engines, which pick
+      // their streams from the shared state
+      default_numpy_generator_t &generator()
+      {
+        static thread_local default_numpy_generator_t engine;
+        static thread_local unsigned long epoch = 0;
+        if (epoch != state.epoch) {
+          engine.seed(state.key, state.streams++);
+          epoch = state.epoch;
+        }
+        return engine;
+      }
+
+      // items drawn from the same stream, so that the result does not
+      // depend on the number of threads
+      static const long chunk_size = 1 << 14;
+      // 64 bits words converted at once
+      static const long batch_size = 2 * philox::lanes;
+
+      template <class T, class F>
+      void parallel_fill(T *out, long n, F const &f)
+      {
+        long const nchunks = (n + chunk_size - 1) / chunk_size;
+        uint64_t const key = state.key;
+        uint64_t const first = state.streams.fetch_add(nchunks);
+        auto chunk = [=, &f](long c) {
+          default_numpy_generator_t engine(key, first + c);
+          long const start = c * chunk_size;
+          f(engine, out + start, std::min(chunk_size, n - start));
+        };
+#ifdef _OPENMP
+        if (n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT && nchunks > 1 &&
+            !omp_in_parallel())
+#pragma omp parallel for
+          for (long c = 0; c < nchunks; ++c)
+            chunk(c);
+        else
+#endif
+          for (long c = 0; c < nchunks; ++c)
+            chunk(c);
+      }
+
+      /* uniform */
+
+      // the 53 upper bits of ``word'', as a double in [0, 1)
+      inline double to_unit(uint64_t word)
+      {
+        return (word >> 11) * (1. / 9007199254740992.);
+      }
+
+      double uniform(default_numpy_generator_t &engine)
+      {
+        uint64_t const word = engine();
+        return to_unit(word | (uint64_t)engine() << 32);
+      }
+
+      void fill_uniform(double *out, long n, double low, double high)
+      {
+        parallel_fill(out, n, [low, high](default_numpy_generator_t &engine,
+                                          double *first, long count) {
+          uint64_t words[batch_size];
+          for (long i = 0; i < count; i += batch_size) {
+            long const m = std::min(batch_size, count - i);
+            engine.fill(words, m);
+            for (long j = 0; j < m; ++j)
+              first[i + j] = low + (high - low) * to_unit(words[j]);
+          }
+        });
+      }
+
+      /* normal, through the 256 layers ziggurat of Marsaglia and Tsang,
+       * ``The Ziggurat Method for Generating Random Variables'' (2000) */
+
+      struct ziggurat {
+        // right edge of the base layer, and area of each layer
+        static constexpr double r = 3.6541528853610088;
+        static constexpr double v = 4.92867323399e-3;
+        // words hold the layer in the low 8 bits, then the sign, and the
+        // abscissa in the 52 upper bits
+        static constexpr double scale = 4503599627370496.;
+
+        uint64_t k[256];
+        double w[256], f[256];
+
+        ziggurat()
+        {
+          double x = r, next = r, q = v / std::exp(-.5 * r * r);
+          k[0] = (uint64_t)(r / q * scale);
+          k[1] = 0;
+          w[0] = q / scale;
+          w[255] = r / scale;
+          f[0] = 1.;
+          f[255] = std::exp(-.5 * r * r);
+          for (int i = 254; i >= 1; --i) {
+            x = std::sqrt(-2. * std::log(v / x + std::exp(-.5 * x * x)));
+            k[i + 1] = (uint64_t)(x / next * scale);
+            next = x;
+            f[i] = std::exp(-.5 * x * x);
+            w[i] = x / scale;
+          }
+        }
+      };
+
+      ziggurat const ziggurat_tables;
+
+      // the rare case of a word outside of the rectangle of its layer
+      double normal_edge(default_numpy_generator_t &engine, uint64_t word)
+      {
+        ziggurat const &z = ziggurat_tables;
+        for (;;) {
+          long const layer = word & 255;
+          bool const negative = word & 256;
+          uint64_t const abscissa = word >> 12;
+          double x = abscissa * z.w[layer];
+          if (abscissa < z.k[layer])
+            return negative ? -x : x;
+          if (layer == 0) {
+            double y;
+            do {
+              x = -std::log1p(-uniform(engine)) / ziggurat::r;
+              y = -std::log1p(-uniform(engine));
+            } while (y + y < x * x);
+            return negative ? -(ziggurat::r + x) : ziggurat::r + x;
+          }
+          if (z.f[layer] + uniform(engine) * (z.f[layer - 1] - z.f[layer]) <
+              std::exp(-.5 * x * x))
+            return negative ? -x : x;
+          word = engine();
+          word |= (uint64_t)engine() << 32;
+        }
+      }
+
+      inline double normal_word(default_numpy_generator_t &engine,
+                                uint64_t word)
+      {
+        ziggurat const &z = ziggurat_tables;
+        long const layer = word & 255;
+        uint64_t const abscissa = word >> 12;
+        if (abscissa >= z.k[layer])
+          return normal_edge(engine, word);
+        double const x = abscissa * z.w[layer];
+        return word & 256 ? -x : x;
+      }
+
+      double standard_normal(default_numpy_generator_t &engine)
+      {
+        uint64_t const word = engine();
+        return normal_word(engine, word | (uint64_t)engine() << 32);
+      }
+
+      void fill_normal(double *out, long n, double loc, double scale)
+      {
+        parallel_fill(out, n, [loc, scale](default_numpy_generator_t &engine,
+                                           double *first, long count) {
+          uint64_t words[batch_size];
+          for (long i = 0; i < count; i += batch_size) {
+            long const m = std::min(batch_size, count - i);
+            engine.fill(words, m);
+            for (long j = 0; j < m; ++j)
+              first[i + j] = loc + scale * normal_word(engine, words[j]);
+          }
+        });
+      }
+
+      /* integers in [low, high), through the multiply and reject method of
+       * Lemire, ``Fast Random Integer Generation in an Interval'' (2019),
+       * for ranges that fit in 32 bits */
+
+      inline long integer_word(default_numpy_generator_t &engine,
+                               uint32_t word, long low, uint32_t range)
+      {
+        uint64_t product = (uint64_t)word * range;
+        if ((uint32_t)product < range) {
+          uint32_t const threshold = -range % range;
+          while ((uint32_t)product < threshold)
+            product = (uint64_t)engine() * range;
+        }
+        return low + (long)(product >> 32);
+      }
+
+      long integer(default_numpy_generator_t &engine, long low, long high)
+      {
+        uint64_t const range = (uint64_t)high - (uint64_t)low;
+        if (range > UINT32_MAX)
+          return std::uniform_int_distribution<long>{low,
+                                                     high - 1}(engine);
+        return integer_word(engine, engine(), low, range);
+      }
+
+      void fill_integers(long *out, long n, long low, long high)
+      {
+        uint64_t const range = (uint64_t)high - (uint64_t)low;
+        if (range > UINT32_MAX)
+          return parallel_fill(out, n, [low, high](
+                                           default_numpy_generator_t &engine,
+                                           long *first, long count) {
+            std::uniform_int_distribution<long> distribution{low, high - 1};
+            std::generate(first, first + count,
+                          [&]() { return distribution(engine); });
+          });
+        parallel_fill(out, n, [low, range](default_numpy_generator_t &engine,
+                                           long *first, long count) {
+          uint64_t words[batch_size];
+          for (long i = 0; i < count; i += 2 * batch_size) {
+            long const m = std::min(2 * batch_size, count - i);
+            engine.fill(words, (m + 1) / 2);
+            for (long j = 0; j < m; ++j)
+              first[i + j] = integer_word(
+                  engine, (uint32_t)(words[j / 2] >> (j % 2 * 32)), low,
+                  range);
+          }
+        });
+      }
+    }
+  }
+}
+PYTHONIC_NS_END
+
+#ifndef PYTHRAN_EXTERN_UNIT_STATE
+namespace pythonic_shared
+{
+  namespace numpy_random
+  {
+    seed_state state{pythonic::numpy::random::details::random_key(), {0},
+                     {1}};
+  }
+}
+#endif
+
+#endif
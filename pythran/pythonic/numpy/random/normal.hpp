@@ -2,16 +2,13 @@
 #define PYTHONIC_NUMPY_RANDOM_NORMAL_HPP
 
 #include "pythonic/include/numpy/random/normal.hpp"
-#include "pythonic/include/numpy/random/generator.hpp"
+#include "pythonic/numpy/random/generator.hpp"
 
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/types/NoneType.hpp"
 #include "pythonic/types/tuple.hpp"
 #include "pythonic/utils/functor.hpp"
 
-#include <random>
-#include <algorithm>
-
 PYTHONIC_NS_BEGIN
 namespace numpy
 {
@@ -23,9 +20,7 @@ namespace numpy
                                      types::array<long, N> const &shape)
     {
       types::ndarray<double, N> result{shape, types::none_type()};
-      std::normal_distribution<double> distribution{loc, scale};
-      std::generate(result.fbegin(), result.fend(),
-                    [&]() { return distribution(details::generator); });
+      details::fill_normal(result.buffer, result.flat_size(), loc, scale);
       return result;
     }
 
@@ -37,7 +32,7 @@ namespace numpy
 
     double normal(double loc, double scale, types::none_type d)
     {
-      return std::normal_distribution<double>{loc, scale}(details::generator);
+      return loc + scale * details::standard_normal(details::generator());
     }
 
     DEFINE_FUNCTOR(pythonic::numpy::random, normal);
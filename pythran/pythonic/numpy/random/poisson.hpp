@@ -1,7 +1,7 @@
 #ifndef PYTHONIC_NUMPY_RANDOM_POISSON_HPP
 #define PYTHONIC_NUMPY_RANDOM_POISSON_HPP
 
-#include "pythonic/include/numpy/random/generator.hpp"
+#include "pythonic/numpy/random/generator.hpp"
 #include "pythonic/include/numpy/random/poisson.hpp"
 
 #include "pythonic/types/NoneType.hpp"
@@ -24,8 +24,14 @@ namespace numpy
     {
       types::ndarray<double, N> result{shape, types::none_type()};
       std::poisson_distribution<long> distribution{lam};
-      std::generate(result.fbegin(), result.fend(),
-                    [&]() { return distribution(details::generator); });
+      details::parallel_fill(
+          result.buffer, result.flat_size(),
+          [&distribution](details::default_numpy_generator_t &engine,
+                          double *first, long count) {
+            auto local = distribution;
+            std::generate(first, first + count,
+                          [&]() { return local(engine); });
+          });
       return result;
     }
 
@@ -37,7 +43,7 @@ namespace numpy
 
     double poisson(double lam, types::none_type d)
     {
-      return std::poisson_distribution<long>{lam}(details::generator);
+      return std::poisson_distribution<long>{lam}(details::generator());
     }
 
     DEFINE_FUNCTOR(pythonic::numpy::random, poisson);
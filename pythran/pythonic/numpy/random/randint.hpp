@@ -2,14 +2,12 @@
 #define PYTHONIC_NUMPY_RANDOM_RANDINT_HPP
 
 #include "pythonic/include/numpy/random/randint.hpp"
-#include "pythonic/include/numpy/random/generator.hpp"
+#include "pythonic/numpy/random/generator.hpp"
 
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/types/tuple.hpp"
 #include "pythonic/utils/functor.hpp"
 
-#include <random>
-
 PYTHONIC_NS_BEGIN
 namespace numpy
 {
@@ -21,9 +19,7 @@ namespace numpy
                                     types::array<long, N> const &shape)
     {
       types::ndarray<long, N> result{shape, types::none_type()};
-      std::uniform_int_distribution<long> distribution{min, max - 1};
-      std::generate(result.fbegin(), result.fend(),
-                    [&]() { return distribution(details::generator); });
+      details::fill_integers(result.buffer, result.flat_size(), min, max);
       return result;
     }
 
@@ -35,14 +31,12 @@ namespace numpy
 
     long randint(long max)
     {
-      return std::uniform_int_distribution<long>{0,
-                                                 max - 1}(details::generator);
+      return details::integer(details::generator(), 0, max);
     }
 
     long randint(long min, long max)
     {
-      return std::uniform_int_distribution<long>{min,
-                                                 max - 1}(details::generator);
+      return details::integer(details::generator(), min, max);
     }
 
     DEFINE_FUNCTOR(pythonic::numpy::random, randint);
@@ -2,16 +2,13 @@
 #define PYTHONIC_NUMPY_RANDOM_RANDOM_HPP
 
 #include "pythonic/include/numpy/random/random.hpp"
-#include "pythonic/include/numpy/random/generator.hpp"
+#include "pythonic/numpy/random/generator.hpp"
 
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/types/NoneType.hpp"
 #include "pythonic/types/tuple.hpp"
 #include "pythonic/utils/functor.hpp"
 
-#include <random>
-#include <algorithm>
-
 PYTHONIC_NS_BEGIN
 namespace numpy
 {
@@ -22,9 +19,7 @@ namespace numpy
     types::ndarray<double, N> random(types::array<long, N> const &shape)
     {
       types::ndarray<double, N> result{shape, types::none_type()};
-      std::uniform_real_distribution<double> distribution{0., 1.};
-      std::generate(result.fbegin(), result.fend(),
-                    [&]() { return distribution(details::generator); });
+      details::fill_uniform(result.buffer, result.flat_size(), 0., 1.);
       return result;
     }
 
@@ -35,7 +30,7 @@ namespace numpy
 
     double random(types::none_type d)
     {
-      return std::uniform_real_distribution<double>{0., 1.}(details::generator);
+      return details::uniform(details::generator());
     }
 
     DEFINE_FUNCTOR(pythonic::numpy::random, random);
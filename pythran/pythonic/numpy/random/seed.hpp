@@ -2,6 +2,7 @@
 #define PYTHONIC_NUMPY_RANDOM_SEED_HPP
 
 #include "pythonic/include/numpy/random/seed.hpp"
+#include "pythonic/numpy/random/generator.hpp"
 #include "pythonic/__builtin__/None.hpp"
 
 PYTHONIC_NS_BEGIN
@@ -13,13 +14,13 @@ namespace numpy
 
     types::none_type seed(long s)
     {
-      details::generator.seed(s);
+      details::seed(s);
       return __builtin__::None;
     }
 
     types::none_type seed(types::none_type)
     {
-      details::generator.seed();
+      details::seed(details::random_key());
       return __builtin__::None;
     }
 
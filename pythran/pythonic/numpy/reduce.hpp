@@ -7,6 +7,9 @@
 #include "pythonic/__builtin__/None.hpp"
 #include "pythonic/__builtin__/ValueError.hpp"
 #include "pythonic/utils/neutral.hpp"
+#include "pythonic/utils/openmp.hpp"
+
+#include <boost/align/aligned_allocator.hpp>
 
 #ifdef USE_BOOST_SIMD
 #include <boost/simd/function/broadcast.hpp>
@@ -17,11 +20,147 @@
 #endif
 
 #include <algorithm>
+#include <iterator>
+#include <vector>
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
+  namespace details
+  {
+    /* Blocked pairwise reduction engine
+     *
+     * The range ``[start, start + n)'' of ``begin'' is recursively split in
+     * halves until it holds at most ``block_size'' elements. Each block is
+     * then reduced into ``accumulators'' independent accumulators, to hide
+     * the latency of ``Op''. As in numpy, combining the partial results
+     * pairwise keeps the rounding error of floating point sums in O(log(n))
+     * instead of O(n).
+     *
+     * When OpenMP is enabled, the top of the recursion tree is spread among
+     * threads and the partial results are combined in the very same order as
+     * the sequential version, so the result does not depend on the number of
+     * threads.
+     *
+     * ``Iterator'' only needs ``++'', ``*'' and ``+= long'', which all the
+     * iterators of numpy expressions provide.
+     */
+    template <class Op, class T, class Iterator>
+    struct pairwise_reduce {
+      static const long accumulators = 4;
+      static const long block_size = 32 * accumulators;
+
+      Iterator begin;
+      T neutral;
+
+      T linear(long start, long n) const
+      {
+        T acc[accumulators] = {neutral, neutral, neutral, neutral};
+        auto iter = begin;
+        iter += start;
+        long i = 0;
+        for (; i + accumulators <= n; i += accumulators)
+          for (long k = 0; k < accumulators; ++k, ++iter)
+            Op{}(acc[k], *iter);
+        for (; i < n; ++i, ++iter)
+          Op{}(acc[0], *iter);
+        Op{}(acc[0], acc[1]);
+        Op{}(acc[2], acc[3]);
+        Op{}(acc[0], acc[2]);
+        return acc[0];
+      }
+
+      T sequential(long start, long n) const
+      {
+        if (n <= block_size)
+          return linear(start, n);
+        long half = n / 2;
+        T acc = sequential(start, half);
+        Op{}(acc, sequential(start + half, n - half));
+        return acc;
+      }
+
+      // the bounds of the ``leaves'' subranges found at depth
+      // log2(leaves) of the recursion tree of ``sequential''
+      void split(long start, long n, long leaves, long *bounds) const
+      {
+        if (leaves == 1) {
+          bounds[0] = start;
+          bounds[1] = start + n;
+        } else {
+          long half = n / 2;
+          split(start, half, leaves / 2, bounds);
+          split(start + half, n - half, leaves / 2, bounds + leaves / 2);
+        }
+      }
+
+      template <class Partials>
+      T combine(Partials const &partials, long first, long last) const
+      {
+        if (last - first == 1)
+          return partials[first];
+        long mid = first + (last - first) / 2;
+        T acc = combine(partials, first, mid);
+        Op{}(acc, combine(partials, mid, last));
+        return acc;
+      }
+
+      T operator()(long n) const
+      {
+#ifdef _OPENMP
+        long const leaf_size =
+            std::max<long>(block_size, PYTHRAN_OPENMP_MIN_ITERATION_COUNT);
+        long const max_leaves = 4 * omp_get_max_threads();
+        long leaves = 1;
+        while (leaves < max_leaves && n / (2 * leaves) >= leaf_size)
+          leaves *= 2;
+        if (leaves > 1) {
+          std::vector<long> bounds(leaves + 1);
+          split(0, n, leaves, bounds.data());
+          std::vector<T, boost::alignment::aligned_allocator<T, alignof(T)>>
+              partials(leaves, neutral);
+#pragma omp parallel for
+          for (long i = 0; i < leaves; ++i)
+            partials[i] = sequential(bounds[i], bounds[i + 1] - bounds[i]);
+          return combine(partials, 0, leaves);
+        }
+#endif
+        return sequential(0, n);
+      }
+    };
+
+    template <class Op, class T, class Iterator>
+    T make_pairwise_reduce(Iterator begin, long n, T neutral)
+    {
+      return pairwise_reduce<Op, T, Iterator>{begin, neutral}(n);
+    }
+
+    /* Same as above, for a reduction along the first axis: the ``n''
+     * subarrays starting at ``begin'' are reduced into ``acc''. Each halving
+     * above ``block_size'' subarrays needs a temporary holding the partial
+     * result of the second half.
+     */
+    template <class Op, class Iterator, class F>
+    void pairwise_accumulate(Iterator begin, long n, F &acc)
+    {
+      static const long block_size = 128;
+      if (n <= block_size) {
+        for (long i = 0; i < n; ++i, ++begin)
+          Op{}(acc, *begin);
+      } else {
+        using A = typename std::decay<F>::type;
+        long half = n / 2;
+        pairwise_accumulate<Op>(begin, half, acc);
+        begin += half;
+        types::ndarray<typename A::dtype, A::value> partial{
+            acc.shape(), utils::neutral<Op, typename A::dtype>::value};
+        pairwise_accumulate<Op>(begin, n - half, partial);
+        Op{}(acc, partial);
+      }
+    }
+  }
+
   template <class Op, size_t N, class vector_form>
   struct _reduce {
     template <class E, class F>
@@ -36,12 +175,24 @@ namespace numpy
 
   template <class Op, class vector_form>
   struct _reduce<Op, 1, vector_form> {
+    // scalar accumulator, use the pairwise engine
     template <class E, class F>
-    F operator()(E &&e, F acc)
+    typename std::enable_if<types::is_dtype<F>::value, F>::type
+    operator()(E &&e, F acc)
     {
-      for (auto value : std::forward<E>(e)) {
-        Op{}(acc, value);
-      }
+      long n = std::distance(e.begin(), e.end());
+      Op{}(acc, details::make_pairwise_reduce<Op>(
+                    e.begin(), n, F(utils::neutral<Op, F>::value)));
+      return acc;
+    }
+
+    // array accumulator, as in a reduction along the first axis
+    template <class E, class F>
+    typename std::enable_if<!types::is_dtype<F>::value, F>::type
+    operator()(E &&e, F acc)
+    {
+      long n = std::distance(e.begin(), e.end());
+      details::pairwise_accumulate<Op>(e.begin(), n, acc);
       return acc;
     }
   };
@@ -53,13 +204,12 @@ namespace numpy
     using T = typename E::dtype;
     using vT = boost::simd::pack<T>;
     static const size_t vN = vT::static_size;
-    const long n = e.size();
+    const long n = std::distance(e.begin(), e.end());
     auto viter = vectorizer::vbegin(e), vend = vectorizer::vend(e);
     const long bound = std::distance(viter, vend);
     if (bound > 0) {
-      auto vacc = *viter;
-      for (++viter; viter != vend; ++viter)
-        Op{}(vacc, *viter);
+      auto vacc = details::make_pairwise_reduce<Op>(
+          viter, bound, vT(utils::neutral<Op, T>::value));
       alignas(sizeof(vT)) T stored[vN];
       boost::simd::store(vacc, &stored[0]);
       for (size_t j = 0; j < vN; ++j)
@@ -114,15 +264,42 @@ namespace numpy
     }
   };
 
+  namespace details
+  {
+    // a contiguous array is reduced as a whole, ! row by row
+    template <class E>
+    E const &flat_view(E const &expr)
+    {
+      return expr;
+    }
+
+    template <class T, size_t N>
+    types::ndarray<T, 1> flat_view(types::ndarray<T, N> const &expr)
+    {
+      return expr.flat();
+    }
+
+    template <class T>
+    types::ndarray<T, 1> const &flat_view(types::ndarray<T, 1> const &expr)
+    {
+      return expr;
+    }
+  }
+
   template <class Op, class E>
   typename std::enable_if<types::is_numexpr_arg<E>::value,
                           reduce_result_type<E>>::type
   reduce(E const &expr, types::none_type)
   {
+    auto &&flat = details::flat_view(expr);
+    using FE = typename std::decay<decltype(flat)>::type;
+    // vector accumulators are ! widened, so only vectorize when the result
+    // type is the dtype
     bool constexpr is_vectorizable =
-        E::is_vectorizable && !std::is_same<typename E::dtype, bool>::value;
+        FE::is_vectorizable && !std::is_same<typename E::dtype, bool>::value &&
+        std::is_same<reduce_result_type<E>, typename E::dtype>::value;
     reduce_result_type<E> p = utils::neutral<Op, typename E::dtype>::value;
-    return reduce_helper<Op, E, is_vectorizable>{}(expr, p);
+    return reduce_helper<Op, FE, is_vectorizable>{}(flat, p);
   }
 
   template <class Op, class E>
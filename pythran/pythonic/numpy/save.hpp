@@ -0,0 +1,65 @@
+#ifndef PYTHONIC_NUMPY_SAVE_HPP
+#define PYTHONIC_NUMPY_SAVE_HPP
+
+#include "pythonic/include/numpy/save.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/npy_format.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/file.hpp"
+#include "pythonic/types/str.hpp"
+#include "pythonic/__builtin__/None.hpp"
+
+#include <fcntl.h>
+
+PYTHONIC_NS_BEGIN
+
+namespace numpy
+{
+  template <class T, size_t N>
+  types::none_type save(types::str const &file,
+                        types::ndarray<T, N> const &arr)
+  {
+    long const n = file.size();
+    utils::file_descriptor fd(n >= 4 && file.substr(n - 4) == ".npy"
+                                  ? file
+                                  : file + ".npy",
+                              O_WRONLY | O_CREAT | O_TRUNC);
+    auto const &shape = arr.shape();
+    std::string const header =
+        utils::npy::write_header<T>(shape.data(), shape.size());
+    fd.write(header.data(), header.size());
+    fd.write(reinterpret_cast<char const *>(arr.buffer),
+             arr.flat_size() * sizeof(T));
+    return __builtin__::None;
+  }
+
+  template <class T, size_t N>
+  types::none_type save(types::file &file, types::ndarray<T, N> const &arr)
+  {
+    auto const &shape = arr.shape();
+    file.write(utils::npy::write_header<T>(shape.data(), shape.size()));
+    file.write(types::str(reinterpret_cast<char const *>(arr.buffer),
+                          arr.flat_size() * sizeof(T)));
+    return __builtin__::None;
+  }
+
+  template <class T, size_t N>
+  types::none_type save(types::file &&file, types::ndarray<T, N> const &arr)
+  {
+    return save(file, arr);
+  }
+
+  template <class F, class E>
+  typename std::enable_if<!types::is_ndarray<E>::value, types::none_type>::type
+  save(F &&file, E const &expr)
+  {
+    return save(std::forward<F>(file),
+                types::ndarray<typename E::dtype, E::value>{expr});
+  }
+
+  DEFINE_FUNCTOR(pythonic::numpy, save);
+}
+PYTHONIC_NS_END
+
+#endif
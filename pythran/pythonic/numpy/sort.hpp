@@ -4,9 +4,17 @@
 #include "pythonic/include/numpy/sort.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
 
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/for_each_lane.hpp"
 #include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/str.hpp"
+#include "pythonic/__builtin__/ValueError.hpp"
 
 PYTHONIC_NS_BEGIN
 namespace numpy
@@ -22,6 +30,23 @@ namespace numpy
       }
     };
 
+    // NaN are sent to the end, as numpy does
+    template <class T>
+    struct _comp_nan_last {
+      bool operator()(T const &i, T const &j) const
+      {
+        return i < j || (j != j && i == i);
+      }
+    };
+
+    template <>
+    struct _comp<float> : _comp_nan_last<float> {
+    };
+
+    template <>
+    struct _comp<double> : _comp_nan_last<double> {
+    };
+
     template <class T>
     struct _comp<std::complex<T>> {
       bool operator()(std::complex<T> const &i, std::complex<T> const &j) const
@@ -32,48 +57,211 @@ namespace numpy
           return std::real(i) < std::real(j);
       }
     };
+
+    enum class sort_kind { quicksort, mergesort, heapsort };
+
+    sort_kind _sort_kind(types::str const &kind)
+    {
+      if (kind == "quicksort")
+        return sort_kind::quicksort;
+      else if (kind == "mergesort" || kind == "stable")
+        return sort_kind::mergesort;
+      else if (kind == "heapsort")
+        return sort_kind::heapsort;
+      else
+        throw types::ValueError("'" + kind +
+                                "' is an invalid value for keyword 'kind'");
+    }
+
+    /* Map a value to an unsigned key whose ordering matches the ordering of
+     * the values, so that they can be sorted digit by digit.
+     */
+    template <class T, class Enable = void>
+    struct radix_key {
+      static const bool value = false;
+    };
+
+    template <class T>
+    struct radix_key<T, typename std::enable_if<std::is_unsigned<T>::value &&
+                                                !std::is_same<T, bool>::value>::type> {
+      static const bool value = true;
+      using type = T;
+      static type to_key(T v)
+      {
+        return v;
+      }
+      static T from_key(type k)
+      {
+        return k;
+      }
+    };
+
+    template <>
+    struct radix_key<bool, void> {
+      static const bool value = true;
+      using type = uint8_t;
+      static type to_key(bool v)
+      {
+        return v;
+      }
+      static bool from_key(type k)
+      {
+        return k;
+      }
+    };
+
     template <class T>
-    void _sort(types::ndarray<T, 1> &out, long axis)
+    struct radix_key<T, typename std::enable_if<std::is_integral<T>::value &&
+                                                std::is_signed<T>::value>::type> {
+      static const bool value = true;
+      using type = typename std::make_unsigned<T>::type;
+      static const type sign_bit = type(1) << (8 * sizeof(T) - 1);
+      static type to_key(T v)
+      {
+        return type(v) ^ sign_bit;
+      }
+      static T from_key(type k)
+      {
+        return T(k ^ sign_bit);
+      }
+    };
+
+    // negative floats have their bits flipped, positive ones their sign bit
+    // set, and NaN are sent to the end, as numpy does
+    template <class T>
+    struct radix_key<
+        T, typename std::enable_if<std::is_floating_point<T>::value &&
+                                   (sizeof(T) == 4 || sizeof(T) == 8)>::type> {
+      static const bool value = true;
+      using type = typename std::conditional<sizeof(T) == 4, uint32_t,
+                                             uint64_t>::type;
+      static const type sign_bit = type(1) << (8 * sizeof(T) - 1);
+      static type to_key(T v)
+      {
+        if (std::isnan(v))
+          return std::numeric_limits<type>::max();
+        type k;
+        std::memcpy(&k, &v, sizeof(T));
+        return (k & sign_bit) ? ~k : (k | sign_bit);
+      }
+      static T from_key(type k)
+      {
+        k = (k & sign_bit) ? (k ^ sign_bit) : ~k;
+        T v;
+        std::memcpy(&v, &k, sizeof(T));
+        return v;
+      }
+    };
+
+    /* Sort lanes of contiguous elements in place, according to a given
+     * algorithm. It owns the scratch memory needed by the radix sort, so that
+     * it is allocated once per thread and ! once per lane.
+     */
+    template <class T, bool has_radix_key = radix_key<T>::value>
+    struct lane_sorter {
+      sort_kind kind;
+
+      void operator()(T *first, T *last)
+      {
+        switch (kind) {
+        case sort_kind::quicksort:
+          std::sort(first, last, _comp<T>{});
+          break;
+        case sort_kind::mergesort:
+          std::stable_sort(first, last, _comp<T>{});
+          break;
+        case sort_kind::heapsort:
+          std::make_heap(first, last, _comp<T>{});
+          std::sort_heap(first, last, _comp<T>{});
+          break;
+        }
+      }
+    };
+
+    template <class T>
+    struct lane_sorter<T, true> : lane_sorter<T, false> {
+      using key_type = typename radix_key<T>::type;
+      // below this size, a comparison sort is faster than a radix sort
+      static const long radix_threshold = 256;
+
+      std::vector<key_type> keys, buffer;
+
+      lane_sorter(sort_kind kind) : lane_sorter<T, false>{kind}
+      {
+      }
+
+      // stable LSD radix sort, one byte at a time
+      void radix_sort(T *first, T *last)
+      {
+        static const size_t nbytes = sizeof(key_type);
+        long const n = last - first;
+        keys.resize(n);
+        buffer.resize(n);
+        std::transform(first, last, keys.begin(), radix_key<T>::to_key);
+
+        long counts[nbytes][256] = {};
+        for (key_type k : keys)
+          for (size_t b = 0; b < nbytes; ++b)
+            ++counts[b][(k >> (8 * b)) & 0xFF];
+
+        key_type *from = keys.data(), *to = buffer.data();
+        for (size_t b = 0; b < nbytes; ++b) {
+          long *count = counts[b];
+          // every key shares the same digit, nothing to do
+          if (count[(from[0] >> (8 * b)) & 0xFF] == n)
+            continue;
+          long offset = 0;
+          for (size_t d = 0; d < 256; ++d) {
+            long c = count[d];
+            count[d] = offset;
+            offset += c;
+          }
+          for (long i = 0; i < n; ++i)
+            to[count[(from[i] >> (8 * b)) & 0xFF]++] = from[i];
+          std::swap(from, to);
+        }
+        std::transform(from, from + n, first, radix_key<T>::from_key);
+      }
+
+      void operator()(T *first, T *last)
+      {
+        if (this->kind == sort_kind::mergesort &&
+            last - first >= radix_threshold)
+          radix_sort(first, last);
+        else
+          lane_sorter<T, false>::operator()(first, last);
+      }
+    };
+
+    template <class T>
+    void _sort(types::ndarray<T, 1> &out, long axis, sort_kind kind)
     {
-      std::sort(out.begin(), out.end(), _comp<T>{});
+      lane_sorter<T>{kind}(out.begin(), out.end());
     }
 
     template <class T, size_t N>
-    void _sort(types::ndarray<T, N> &out, long axis)
+    void _sort(types::ndarray<T, N> &out, long axis, sort_kind kind)
     {
       if (axis < 0)
         axis += N;
-
-      axis = axis % N;
-      auto &&out_shape = out.shape();
-      const long step =
-          std::accumulate(out_shape.begin() + axis, out_shape.end(), 1L,
-                          std::multiplies<long>());
-      for (long i = 0; i < out.flat_size() / out_shape[axis] * step;
-           i += step) {
-        std::vector<T> to_sort;
-        T *iter = out.buffer + (i % out.flat_size() + i / out.flat_size());
-        while (iter !=
-               out.buffer + (i % out.flat_size() + i / out.flat_size()) +
-                   step) {
-          to_sort.push_back(*iter);
-          iter += step / out_shape[axis];
-        }
-        std::sort(to_sort.begin(), to_sort.end(), _comp<T>{});
-        iter = out.buffer + (i % out.flat_size() + i / out.flat_size());
-        for (auto val : to_sort) {
-          *iter = val;
-          iter += step / out_shape[axis];
-        }
-      }
+      if (axis < 0 || size_t(axis) >= N)
+        throw types::ValueError("axis out of bounds");
+      if (out.shape()[axis] <= 1)
+        return;
+      lane_sorter<T> sorter{kind};
+      utils::for_each_lane(out, axis, [sorter](T *first, T *last,
+                                               long) mutable {
+        sorter(first, last);
+      });
     }
   }
 
   template <class T, size_t N>
-  types::ndarray<T, N> sort(types::ndarray<T, N> const &expr, long axis)
+  types::ndarray<T, N> sort(types::ndarray<T, N> const &expr, long axis,
+                            types::str const &kind)
   {
     types::ndarray<T, N> out = expr.copy();
-    _sort(out, axis);
+    _sort(out, axis, _sort_kind(kind));
     return out;
   }
 
@@ -3,19 +3,39 @@
 
 #include "pythonic/include/numpy/take.hpp"
 
-#include "pythonic/types/numpy_fexpr.hpp"
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/gather_scatter.hpp"
+#include "pythonic/utils/stream_compaction.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/NoneType.hpp"
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/__builtin__/IndexError.hpp"
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
   template <class F, class T>
-  auto take(T &&expr, F &&indices)
-      -> decltype(types::numpy_fexpr<T, F>(std::forward<T>(expr),
-                                           std::forward<F>(indices)))
+  types::ndarray<
+      typename types::dtype_of<typename std::decay<T>::type>::type,
+      std::decay<decltype(asarray(std::declval<F>()))>::type::value>
+  take(T &&expr, F &&indices)
   {
-    return types::numpy_fexpr<T, F>(std::forward<T>(expr),
-                                    std::forward<F>(indices));
+    auto const &arr = utils::dense(expr);
+    auto vind = asarray(std::forward<F>(indices));
+    long const size = arr.flat_size(), n = vind.flat_size();
+
+    // no early exit, so that the check vectorizes
+    bool out_of_bounds = false;
+    for (long i = 0; i < n; ++i)
+      out_of_bounds |= (vind.buffer[i] < -size) | (vind.buffer[i] >= size);
+    if (out_of_bounds)
+      throw types::IndexError("index out of bounds");
+
+    types::ndarray<typename std::decay<decltype(arr)>::type::dtype,
+                   decltype(vind)::value> out(vind.shape(), __builtin__::None);
+    utils::gather(out.buffer, arr.buffer, size, 1, vind.buffer, n);
+    return out;
   }
 
   DEFINE_FUNCTOR(pythonic::numpy, take);
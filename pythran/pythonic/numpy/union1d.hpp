@@ -5,40 +5,29 @@
 
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/numpy/unique.hpp"
 
-#include <set>
+#include <algorithm>
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
-  namespace
-  {
-    template <class I, class O>
-    void _union1d(I begin, I end, O &out, utils::int_<1>)
-    {
-      for (; begin != end; ++begin)
-        out.insert(*begin);
-    }
-
-    template <class I, class O, size_t N>
-    void _union1d(I begin, I end, O &out, utils::int_<N>)
-    {
-      for (; begin != end; ++begin)
-        _union1d((*begin).begin(), (*begin).end(), out, utils::int_<N - 1>());
-    }
-  }
-
   template <class E, class F>
   types::ndarray<
       typename __combined<typename E::dtype, typename F::dtype>::type, 1>
   union1d(E const &e, F const &f)
   {
-    std::set<typename __combined<typename E::dtype, typename F::dtype>::type>
-        res;
-    _union1d(e.begin(), e.end(), res, utils::int_<E::value>());
-    _union1d(f.begin(), f.end(), res, utils::int_<F::value>());
-    return res;
+    using T = typename __combined<typename E::dtype, typename F::dtype>::type;
+    auto ae = asarray(e);
+    auto af = asarray(f);
+    types::ndarray<T, 1> values(
+        types::array<long, 1>{{ae.flat_size() + af.flat_size()}},
+        __builtin__::None);
+    std::copy(af.fbegin(), af.fend(),
+              std::copy(ae.fbegin(), ae.fend(), values.buffer));
+    return details::unique_values(values);
   }
 
   DEFINE_FUNCTOR(pythonic::numpy, union1d)
@@ -6,84 +6,312 @@
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/types/tuple.hpp"
+#include "pythonic/numpy/asarray.hpp"
+#include "pythonic/numpy/sort.hpp"
 
-#include <set>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
 
 PYTHONIC_NS_BEGIN
 
 namespace numpy
 {
-  namespace
+  namespace details
   {
-    template <class I, class O>
-    void _unique1(I begin, I end, O &out, utils::int_<1>)
+    // NaN are considered equal to each other, as numpy does
+    template <class T>
+    typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+    unique_equal(T a, T b)
     {
-      out.insert(begin, end);
+      return a == b || (std::isnan(a) && std::isnan(b));
     }
 
-    template <class I, class O, size_t N>
-    void _unique1(I begin, I end, O &out, utils::int_<N>)
+    template <class T>
+    typename std::enable_if<!std::is_floating_point<T>::value, bool>::type
+    unique_equal(T const &a, T const &b)
     {
-      for (; begin != end; ++begin)
-        _unique1((*begin).begin(), (*begin).end(), out, utils::int_<N - 1>());
+      return a == b;
     }
 
-    template <class I, class O0, class O1>
-    void _unique2(I begin, I end, O0 &out0, O1 &out1, long &i, utils::int_<1>)
+    template <class T>
+    types::ndarray<T, 1> unique_prefix(T const *data, long n)
     {
-      for (; begin != end; ++begin, ++i) {
-        auto pair = out0.insert(*begin);
-        if (pair.second)
-          out1.push_back(i);
-      }
+      types::ndarray<T, 1> out(types::array<long, 1>{{n}}, __builtin__::None);
+      std::copy(data, data + n, out.buffer);
+      return out;
     }
 
-    template <class I, class O0, class O1, size_t N>
-    void _unique2(I begin, I end, O0 &out0, O1 &out1, long &i, utils::int_<N>)
-    {
-      for (; begin != end; ++begin)
-        _unique2((*begin).begin(), (*begin).end(), out0, out1, i,
-                 utils::int_<N - 1>());
-    }
-    template <class I, class O0, class O1, class O2>
-    void _unique3(I begin, I end, O0 &out0, O1 &out1, O2 &out2, long &i,
-                  utils::int_<1>)
+    /* Order of the elements of ``data'' once stably sorted, through a radix
+     * sort, along with their sorted keys. Zeros of both signs share the same
+     * key, as they compare equal.
+     */
+    template <class T>
+    void radix_argsort(T const *data, long n, std::vector<long> &perm,
+                       std::vector<typename radix_key<T>::type> &keys)
     {
-      for (; begin != end; ++begin, ++i) {
-        auto pair = out0.insert(*begin);
-        out2[i] = std::distance(out0.begin(), pair.first);
-        if (pair.second)
-          out1.push_back(i);
+      using key_type = typename radix_key<T>::type;
+      static const size_t nbytes = sizeof(key_type);
+      std::vector<key_type> keys_tmp(n);
+      std::vector<long> perm_tmp(n);
+      perm.resize(n);
+      keys.resize(n);
+      std::iota(perm.begin(), perm.end(), 0L);
+      if (n == 0)
+        return;
+      std::transform(data, data + n, keys.begin(), [](T v) {
+        return radix_key<T>::to_key(v == T(0) ? T(0) : v);
+      });
+
+      long counts[nbytes][256] = {};
+      for (key_type k : keys)
+        for (size_t b = 0; b < nbytes; ++b)
+          ++counts[b][(k >> (8 * b)) & 0xFF];
+
+      for (size_t b = 0; b < nbytes; ++b) {
+        long *count = counts[b];
+        if (count[(keys[0] >> (8 * b)) & 0xFF] == n)
+          continue;
+        long offset = 0;
+        for (size_t d = 0; d < 256; ++d) {
+          long c = count[d];
+          count[d] = offset;
+          offset += c;
+        }
+        for (long i = 0; i < n; ++i) {
+          long j = count[(keys[i] >> (8 * b)) & 0xFF]++;
+          keys_tmp[j] = keys[i];
+          perm_tmp[j] = perm[i];
+        }
+        keys.swap(keys_tmp);
+        perm.swap(perm_tmp);
       }
     }
-    template <class I, class O0, class O1, class O2, size_t N>
-    void _unique3(I begin, I end, O0 &out0, O1 &out1, O2 &out2, long &i,
-                  utils::int_<N>)
+
+    /* Sorted distinct values of a sequence, the index of the first
+     * occurrence of each of them, their number of occurrences and, if
+     * requested, the index of the value of each element among the distinct
+     * ones.
+     *
+     * Integers with few distinct values go through an open addressing hash
+     * table, which is linear and only sorts the distinct values. Otherwise,
+     * the elements are sorted, through a stable radix sort for integers and
+     * floats, then grouped.
+     */
+    template <class T>
+    struct unique_groups {
+      types::ndarray<T, 1> values;
+      std::vector<long> index, counts, inverse;
+
+      unique_groups() = default;
+
+      unique_groups(T const *data, long n, bool with_inverse)
+      {
+        if (!hash(data, n, with_inverse))
+          sort(data, n, with_inverse);
+      }
+
+      // only succeeds for integers with few distinct values
+      bool hash(T const *data, long n, bool with_inverse)
+      {
+        return hash(data, n, with_inverse, std::is_integral<T>());
+      }
+
+      void sort(T const *data, long n, bool with_inverse)
+      {
+        sort(data, n, with_inverse,
+             std::integral_constant<bool, radix_key<T>::value>());
+      }
+
+    private:
+      void sort(T const *data, long n, bool with_inverse, std::true_type)
+      {
+        std::vector<long> perm;
+        std::vector<typename radix_key<T>::type> keys;
+        radix_argsort(data, n, perm, keys);
+        group(data, perm, with_inverse,
+              [&keys](long j) { return keys[j - 1] == keys[j]; });
+      }
+
+      void sort(T const *data, long n, bool with_inverse, std::false_type)
+      {
+        std::vector<long> perm(n);
+        std::iota(perm.begin(), perm.end(), 0L);
+        std::stable_sort(perm.begin(), perm.end(), [data](long i, long j) {
+          return _comp<T>{}(data[i], data[j]);
+        });
+        group(data, perm, with_inverse, [data, &perm](long j) {
+          return unique_equal(data[perm[j - 1]], data[perm[j]]);
+        });
+      }
+
+      /* Group the elements of ``data'' ordered by ``perm'', ``same(j)''
+       * telling whether the j-th element belongs to the same group as the
+       * previous one.
+       */
+      template <class F>
+      void group(T const *data, std::vector<long> const &perm,
+                 bool with_inverse, F const &same)
+      {
+        long const n = perm.size();
+        index.clear();
+        counts.clear();
+        if (with_inverse)
+          inverse.resize(n);
+        for (long j = 0; j < n; ++j) {
+          // the sort being stable, a group starts with its first occurrence
+          if (j == 0 || !same(j)) {
+            index.push_back(perm[j]);
+            counts.push_back(0);
+          }
+          ++counts.back();
+          if (with_inverse)
+            inverse[perm[j]] = index.size() - 1;
+        }
+        values = types::ndarray<T, 1>(
+            types::array<long, 1>{{long(index.size())}}, __builtin__::None);
+        for (size_t k = 0; k < index.size(); ++k)
+          values.buffer[k] = data[index[k]];
+      }
+
+      bool hash(T const *data, long n, bool with_inverse, std::false_type)
+      {
+        return false;
+      }
+
+      /* Values are hashed through their radix key, which preserves their
+       * order, so that the distinct ones can be sorted by key. Small types
+       * are mapped directly to their slot, which never fails.
+       */
+      bool hash(T const *data, long n, bool with_inverse, std::true_type)
+      {
+        using key_type = typename radix_key<T>::type;
+        // a direct mapping is only worth its initialization on large inputs
+        bool const direct =
+            sizeof(T) == 1 || (sizeof(T) == 2 && n >= (1L << 12));
+        // past that many distinct values, sorting is faster
+        long const limit = direct ? n : std::max(n / 8, 1024L);
+        int log_capacity = direct ? 8 * sizeof(T) : 10;
+        std::vector<key_type> slot_keys(1UL << log_capacity);
+        std::vector<long> slot_ids(1UL << log_capacity, -1);
+        std::vector<key_type> keys;
+        index.clear();
+        counts.clear();
+        if (with_inverse)
+          inverse.resize(n);
+
+        for (long i = 0; i < n; ++i) {
+          key_type key = radix_key<T>::to_key(data[i]);
+          size_t slot = direct ? key : probe(slot_keys, slot_ids, key,
+                                             log_capacity);
+          long id = slot_ids[slot];
+          if (id < 0) {
+            // bail out early on data that are mostly distinct
+            if (long(keys.size()) == limit ||
+                (!direct && i >= 1024 && 2 * long(keys.size()) > i))
+              return false;
+            id = slot_ids[slot] = keys.size();
+            slot_keys[slot] = key;
+            keys.push_back(key);
+            index.push_back(i);
+            counts.push_back(0);
+            // keep the load factor below one half
+            if (!direct && 2 * keys.size() > slot_ids.size())
+              rehash(slot_keys, slot_ids, keys, ++log_capacity);
+          }
+          ++counts[id];
+          if (with_inverse)
+            inverse[i] = id;
+        }
+
+        // sort the distinct values and renumber them accordingly
+        long const k = keys.size();
+        std::vector<long> order(k), rank(k);
+        std::iota(order.begin(), order.end(), 0L);
+        std::sort(order.begin(), order.end(),
+                  [&keys](long i, long j) { return keys[i] < keys[j]; });
+        values = types::ndarray<T, 1>(types::array<long, 1>{{k}},
+                                      __builtin__::None);
+        std::vector<long> sorted_index(k), sorted_counts(k);
+        for (long r = 0; r < k; ++r) {
+          rank[order[r]] = r;
+          values.buffer[r] = radix_key<T>::from_key(keys[order[r]]);
+          sorted_index[r] = index[order[r]];
+          sorted_counts[r] = counts[order[r]];
+        }
+        index.swap(sorted_index);
+        counts.swap(sorted_counts);
+        if (with_inverse)
+          for (long &id : inverse)
+            id = rank[id];
+        return true;
+      }
+
+      template <class K>
+      static size_t probe(std::vector<K> const &slot_keys,
+                          std::vector<long> const &slot_ids, K key,
+                          int log_capacity)
+      {
+        size_t const mask = slot_ids.size() - 1;
+        // Fibonacci hashing
+        size_t slot = (uint64_t(key) * 0x9E3779B97F4A7C15ULL) >>
+                      (64 - log_capacity);
+        while (slot_ids[slot] >= 0 && slot_keys[slot] != key)
+          slot = (slot + 1) & mask;
+        return slot;
+      }
+
+      template <class K>
+      static void rehash(std::vector<K> &slot_keys, std::vector<long> &slot_ids,
+                         std::vector<K> const &keys, int log_capacity)
+      {
+        slot_keys.assign(1UL << log_capacity, K());
+        slot_ids.assign(1UL << log_capacity, -1);
+        for (size_t id = 0; id < keys.size(); ++id) {
+          size_t slot = probe(slot_keys, slot_ids, keys[id], log_capacity);
+          slot_keys[slot] = keys[id];
+          slot_ids[slot] = id;
+        }
+      }
+    };
+  }
+
+  namespace details
+  {
+    /* Sorted distinct values of ``values'', which is reordered in the
+     * process.
+     */
+    template <class T>
+    types::ndarray<T, 1> unique_values(types::ndarray<T, 1> &values)
     {
-      for (; begin != end; ++begin)
-        _unique3((*begin).begin(), (*begin).end(), out0, out1, out2, i,
-                 utils::int_<N - 1>());
+      T *first = values.buffer, *last = values.buffer + values.flat_size();
+      unique_groups<T> groups;
+      if (groups.hash(first, last - first, false))
+        return groups.values;
+      // sort, through a radix sort for integers and floats, then compact
+      lane_sorter<T>{sort_kind::mergesort}(first, last);
+      last = std::unique(first, last, unique_equal<T>);
+      return unique_prefix(first, last - first);
     }
   }
+
   template <class E>
   types::ndarray<typename E::dtype, 1> unique(E const &expr)
   {
-    std::set<typename E::dtype> res;
-    _unique1(expr.begin(), expr.end(), res, utils::int_<E::value>());
-    return types::ndarray<typename E::dtype, 1>(res);
+    types::ndarray<typename E::dtype, 1> values = asarray(expr).flat().copy();
+    return details::unique_values(values);
   }
 
   template <class E>
   std::tuple<types::ndarray<typename E::dtype, 1>, types::ndarray<long, 1>>
   unique(E const &expr, bool return_index)
   {
-    std::set<typename E::dtype> res;
-    std::vector<long> return_index_res;
-    long i = 0;
-    _unique2(expr.begin(), expr.end(), res, return_index_res, i,
-             utils::int_<E::value>());
-    return std::make_tuple(types::ndarray<typename E::dtype, 1>(res),
-                           types::ndarray<long, 1>(return_index_res));
+    auto arr = asarray(expr);
+    details::unique_groups<typename E::dtype> groups(
+        arr.buffer, arr.flat_size(), false);
+    return std::make_tuple(groups.values,
+                           types::ndarray<long, 1>(groups.index));
   }
 
   template <class E>
@@ -91,16 +319,27 @@ namespace numpy
              types::ndarray<long, 1>>
   unique(E const &expr, bool return_index, bool return_inverse)
   {
-    std::set<typename E::dtype> res;
-    std::vector<long> return_index_res;
-    types::ndarray<long, 1> return_inverse_res(
-        types::array<long, 1>{{expr.flat_size()}}, __builtin__::None);
-    long i = 0;
-    _unique3(expr.begin(), expr.end(), res, return_index_res,
-             return_inverse_res, i, utils::int_<E::value>());
-    return std::make_tuple(types::ndarray<typename E::dtype, 1>(res),
-                           types::ndarray<long, 1>(return_index_res),
-                           return_inverse_res);
+    auto arr = asarray(expr);
+    details::unique_groups<typename E::dtype> groups(arr.buffer,
+                                                     arr.flat_size(), true);
+    return std::make_tuple(groups.values,
+                           types::ndarray<long, 1>(groups.index),
+                           types::ndarray<long, 1>(groups.inverse));
+  }
+
+  template <class E>
+  std::tuple<types::ndarray<typename E::dtype, 1>, types::ndarray<long, 1>,
+             types::ndarray<long, 1>, types::ndarray<long, 1>>
+  unique(E const &expr, bool return_index, bool return_inverse,
+         bool return_counts)
+  {
+    auto arr = asarray(expr);
+    details::unique_groups<typename E::dtype> groups(arr.buffer,
+                                                     arr.flat_size(), true);
+    return std::make_tuple(groups.values,
+                           types::ndarray<long, 1>(groups.index),
+                           types::ndarray<long, 1>(groups.inverse),
+                           types::ndarray<long, 1>(groups.counts));
   }
 
   DEFINE_FUNCTOR(pythonic::numpy, unique)
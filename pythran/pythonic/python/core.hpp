@@ -81,6 +81,32 @@ namespace python
     PyErr_SetString(PyExc_TypeError, oss.str().c_str());
     return nullptr;
   }
+
+#if PY_VERSION_HEX >= 0x03070000
+  // same for the ``nargs'' positional arguments at ``args'', followed by the
+  // values of the keyword arguments named in ``kwnames''
+  std::nullptr_t raise_invalid_argument(char const name[],
+                                        char const alternatives[],
+                                        PyObject *const *args,
+                                        Py_ssize_t nargs, PyObject *kwnames)
+  {
+    PyObject *tuple = PyTuple_New(nargs);
+    for (Py_ssize_t i = 0; i < nargs; ++i) {
+      Py_INCREF(args[i]);
+      PyTuple_SET_ITEM(tuple, i, args[i]);
+    }
+    PyObject *kwargs = nullptr;
+    if (kwnames) {
+      kwargs = PyDict_New();
+      for (Py_ssize_t i = 0, n = PyTuple_GET_SIZE(kwnames); i < n; ++i)
+        PyDict_SetItem(kwargs, PyTuple_GET_ITEM(kwnames, i), args[nargs + i]);
+    }
+    raise_invalid_argument(name, alternatives, tuple, kwargs);
+    Py_DECREF(tuple);
+    Py_XDECREF(kwargs);
+    return nullptr;
+  }
+#endif
 }
 
 PYTHONIC_NS_END
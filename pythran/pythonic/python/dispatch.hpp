@@ -0,0 +1,357 @@
+#ifndef PYTHONIC_PYTHON_DISPATCH_HPP
+#define PYTHONIC_PYTHON_DISPATCH_HPP
+
+#ifdef ENABLE_PYTHON_MODULE
+
+#include "Python.h"
+#include "pythonic/python/sequence.hpp"
+#include "pythonic/utils/unit_state.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+/* Exported functions take their arguments as a C array and the names of
+ * the keyword ones since Python 3.7, and as a tuple and a dict before.
+ */
+#if PY_VERSION_HEX >= 0x03070000
+#define PYTHRAN_METH_CALL (METH_FASTCALL | METH_KEYWORDS)
+#define PYTHRAN_CALL_PARAMETERS                                                \
+  PyObject *const *args, Py_ssize_t nargs, PyObject *kw
+#define PYTHRAN_CALL_ARGUMENTS args, nargs, kw
+#else
+#define PYTHRAN_METH_CALL (METH_VARARGS | METH_KEYWORDS)
+#define PYTHRAN_CALL_PARAMETERS PyObject *args, PyObject *kw
+#define PYTHRAN_CALL_ARGUMENTS args, kw
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace python
+{
+
+  namespace details
+  {
+    /* Store ``value'' at the position of the parameter named ``key'' among
+     * the ``size'' ones at ``keywords'', after the ``n'' positional ones.
+     * False if there is no such parameter or if it is already set.
+     */
+    bool store_keyword(PyObject *key, PyObject *value,
+                       char const *const *keywords, PyObject **out,
+                       Py_ssize_t n, Py_ssize_t size)
+    {
+      for (Py_ssize_t i = n; i < size; ++i)
+#if PY_MAJOR_VERSION >= 3
+        if (PyUnicode_CompareWithASCIIString(key, keywords[i]) == 0) {
+#else
+        if (PyString_Check(key) &&
+            strcmp(PyString_AS_STRING(key), keywords[i]) == 0) {
+#endif
+          if (out[i])
+            return false;
+          out[i] = value;
+          return true;
+        }
+      return false;
+    }
+
+    // number of arguments stored in ``out'', -1 if they leave a gap
+    Py_ssize_t count_arguments(PyObject *const *out, Py_ssize_t size)
+    {
+      Py_ssize_t count = 0;
+      while (count < size && out[count])
+        ++count;
+      for (Py_ssize_t i = count; i < size; ++i)
+        if (out[i])
+          return -1;
+      return count;
+    }
+  }
+
+  /* Gather the arguments of a call in the order of the ``size'' parameter
+   * names at ``keywords'' and point ``argv'' to them. Positional only
+   * calls are read in place, otherwise the arguments are stored in
+   * ``buffer''.
+   *
+   * Returns the number of arguments, which must be the first parameters,
+   * or -1 if they cannot match any of them.
+   */
+#if PY_VERSION_HEX >= 0x03070000
+  Py_ssize_t unpack_arguments(PyObject *const *args, Py_ssize_t nargs,
+                              PyObject *kwnames, char const *const *keywords,
+                              PyObject **buffer, Py_ssize_t size,
+                              PyObject *const *&argv)
+  {
+    argv = args;
+    if (!kwnames || !PyTuple_GET_SIZE(kwnames))
+      return nargs;
+    if (nargs > size)
+      return -1;
+
+    argv = buffer;
+    std::copy(args, args + nargs, buffer);
+    std::fill(buffer + nargs, buffer + size, nullptr);
+    for (Py_ssize_t i = 0, n = PyTuple_GET_SIZE(kwnames); i < n; ++i)
+      if (!details::store_keyword(PyTuple_GET_ITEM(kwnames, i),
+                                  args[nargs + i], keywords, buffer, nargs,
+                                  size))
+        return -1;
+    return details::count_arguments(buffer, size);
+  }
+#else
+  Py_ssize_t unpack_arguments(PyObject *args, PyObject *kw,
+                              char const *const *keywords, PyObject **buffer,
+                              Py_ssize_t size, PyObject *const *&argv)
+  {
+    Py_ssize_t const nargs = PyTuple_GET_SIZE(args);
+    PyObject *const *items = reinterpret_cast<PyTupleObject *>(args)->ob_item;
+    argv = items;
+    if (!kw || !PyDict_Size(kw))
+      return nargs;
+    if (nargs > size)
+      return -1;
+
+    argv = buffer;
+    std::copy(items, items + nargs, buffer);
+    std::fill(buffer + nargs, buffer + size, nullptr);
+    PyObject *key, *value;
+    Py_ssize_t pos = 0;
+    while (PyDict_Next(kw, &pos, &key, &value))
+      if (!details::store_keyword(key, value, keywords, buffer, nargs, size))
+        return -1;
+    return details::count_arguments(buffer, size);
+  }
+#endif
+
+  /* Conversions of the elements of containers may fail after the
+   * containers were accepted, leaving an exception set. The fast calling
+   * convention is then not checked by every interpreter, so the result is
+   * dropped here.
+   */
+  PyObject *check_result(PyObject *result)
+  {
+    if (result && PyErr_Occurred()) {
+      Py_DECREF(result);
+      return nullptr;
+    }
+    return result;
+  }
+
+  /* Features of the arguments of a call that their conversions depend on
+   *
+   * These are the types of the objects, the dtype, rank and layout of
+   * arrays, the item type of buffers and the same features for the size
+   * and the first element of containers, as every ``is_convertible'' only
+   * looks at them. Two calls with the same fingerprint thus select the same
+   * overload.
+   */
+  class fingerprint
+  {
+  public:
+    static const size_t capacity = 16;
+
+    fingerprint() : size(0)
+    {
+    }
+
+    /* Add the features of ``obj'', false if they do not fit or if its type
+     * is not static, as a new type may then be allocated at the same
+     * address.
+     */
+    bool add(PyObject *obj)
+    {
+      PyTypeObject *type = Py_TYPE(obj);
+      if (PyType_HasFeature(type, Py_TPFLAGS_HEAPTYPE) ||
+          !push((uintptr_t)type))
+        return false;
+#ifdef PYTHONIC_TYPES_NDARRAY_HPP
+      if (PyArray_Check(obj))
+        return push(array_features(reinterpret_cast<PyArrayObject *>(obj)));
+#endif
+      if (PyList_Check(obj)) {
+        Py_ssize_t n = PyList_GET_SIZE(obj);
+        return push(n != 0) && (!n || add(PyList_GET_ITEM(obj, 0)));
+      }
+      if (PyTuple_Check(obj)) {
+        Py_ssize_t n = PyTuple_GET_SIZE(obj);
+        if (!push(n))
+          return false;
+        for (Py_ssize_t i = 0; i < n; ++i)
+          if (!add(PyTuple_GET_ITEM(obj, i)))
+            return false;
+        return true;
+      }
+      if (PyDict_Check(obj)) {
+        PyObject *key, *value;
+        Py_ssize_t pos = 0;
+        if (!PyDict_Next(obj, &pos, &key, &value))
+          return push(0);
+        return push(1) && add(key) && add(value);
+      }
+      if (PyAnySet_Check(obj)) {
+        PyObject *iterator = PyObject_GetIter(obj);
+        PyObject *item = PyIter_Next(iterator);
+        Py_DECREF(iterator);
+        if (!item)
+          return push(0);
+        bool res = push(1) && add(item);
+        Py_DECREF(item);
+        return res;
+      }
+      if (typed_buffer::supports(obj)) {
+        typed_buffer buffer(obj);
+        return push(buffer.kind()) && push(buffer.itemsize());
+      }
+      return true;
+    }
+
+    bool push(uintptr_t word)
+    {
+      if (size == capacity)
+        return false;
+      words[size++] = word;
+      return true;
+    }
+
+    size_t hash() const
+    {
+      uint64_t h = size;
+      for (size_t i = 0; i < size; ++i) {
+        h = (h ^ words[i]) * 0x9E3779B97F4A7C15ULL;
+        h ^= h >> 29;
+      }
+      return h;
+    }
+
+    bool operator==(fingerprint const &other) const
+    {
+      return size == other.size &&
+             std::equal(words, words + size, other.words);
+    }
+
+  private:
+#ifdef PYTHONIC_TYPES_NDARRAY_HPP
+    // what the checks of ndarray, numpy_gexpr and numpy_texpr look at
+    static uintptr_t array_features(PyArrayObject *arr)
+    {
+      long const n = PyArray_NDIM(arr);
+      auto const *stride = PyArray_STRIDES(arr);
+      auto const *dims = PyArray_DIMS(arr);
+      long const itemsize = PyArray_ITEMSIZE(arr);
+
+      bool c_packed = true, f_packed = true, strided = false;
+      for (long i = n - 1, current = itemsize; i >= 0; --i) {
+        if (stride[i] != current) {
+          c_packed = false;
+          break;
+        }
+        current *= dims[i];
+      }
+      for (long i = 0, current = itemsize; i < n; ++i) {
+        if (stride[i] != current) {
+          f_packed = false;
+          break;
+        }
+        current *= dims[i];
+      }
+      for (long i = n - 1, current = itemsize; i >= 0; --i) {
+        if (stride[i] < 0)
+          break;
+        if (stride[i] != current) {
+          strided = true;
+          break;
+        }
+        current *= dims[i];
+      }
+      PyObject *base = PyArray_BASE(arr);
+      bool const base_array = base && PyArray_Check(base);
+      bool const same_rank =
+          base_array &&
+          PyArray_NDIM(reinterpret_cast<PyArrayObject *>(base)) == n;
+      int const flags = PyArray_FLAGS(arr);
+
+      return (uintptr_t)PyArray_TYPE(arr) | (uintptr_t)n << 16 |
+             (uintptr_t)c_packed << 24 | (uintptr_t)f_packed << 25 |
+             (uintptr_t)strided << 26 | (uintptr_t)base_array << 27 |
+             (uintptr_t)same_rank << 28 |
+             (uintptr_t)((flags & NPY_ARRAY_C_CONTIGUOUS) != 0) << 29 |
+             (uintptr_t)((flags & NPY_ARRAY_F_CONTIGUOUS) != 0) << 30;
+    }
+#endif
+
+    uintptr_t words[capacity];
+    size_t size;
+  };
+
+  /* Overload selected for each fingerprint met so far by an exported
+   * function, in a small open addressing hash table.
+   *
+   * Calls run with the GIL held, so the table needs no lock.
+   */
+  class dispatch_table
+  {
+  public:
+    using accepts_type = bool (*)(PyObject *const *, Py_ssize_t);
+
+    /* Index of the first of the ``n'' overloads whose ``accepts'' is true
+     * for the ``nargs'' arguments at ``args'', -1 if there is none.
+     */
+    long find(PyObject *const *args, Py_ssize_t nargs,
+              accepts_type const *accepts, long n)
+    {
+      // checking a single overload is cheaper than looking it up
+      if (n == 1)
+        return accepts[0](args, nargs) ? 0 : -1;
+
+      fingerprint key;
+      bool cacheable = key.push(nargs);
+      for (Py_ssize_t i = 0; cacheable && i < nargs; ++i)
+        cacheable = key.add(args[i]);
+
+      size_t slot = cacheable ? key.hash() % size : 0;
+      if (cacheable) {
+        for (size_t probe = 0; probe < size; ++probe) {
+          entry const &e = entries[(slot + probe) % size];
+          if (e.target == empty)
+            break;
+          if (e.key == key)
+            return e.target;
+        }
+      }
+
+      long target = -1;
+      for (long i = 0; i < n; ++i)
+        if (accepts[i](args, nargs)) {
+          target = i;
+          break;
+        }
+
+      // once full, the table is left as is
+      if (cacheable && count < size) {
+        while (entries[slot].target != empty)
+          slot = (slot + 1) % size;
+        entries[slot].key = key;
+        entries[slot].target = target;
+        ++count;
+      }
+      return target;
+    }
+
+  private:
+    static const size_t size = 32;
+    static const long empty = -2;
+
+    struct entry {
+      fingerprint key;
+      long target = empty;
+    };
+
+    entry entries[size];
+    size_t count = 0;
+  };
+}
+PYTHONIC_NS_END
+
+#endif
+
+#endif
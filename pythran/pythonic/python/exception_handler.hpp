@@ -4,15 +4,18 @@
 #ifdef ENABLE_PYTHON_MODULE
 
 #include "Python.h"
+#include "pythonic/utils/allocate.hpp"
 #include <utility>
 
 PYTHONIC_NS_BEGIN
 
 // This function have to be include after every others exceptions to have
 // correct exception macro defined.
+// Temporaries of the call are cached by the pool until it returns.
 template <class F>
 PyObject *handle_python_exception(F &&f)
 {
+  utils::pool_scope scope;
   try {
     return f();
   }
@@ -0,0 +1,223 @@
+#ifndef PYTHONIC_PYTHON_SEQUENCE_HPP
+#define PYTHONIC_PYTHON_SEQUENCE_HPP
+
+#ifdef ENABLE_PYTHON_MODULE
+
+#include "pythonic/python/core.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+PYTHONIC_NS_BEGIN
+
+namespace python
+{
+
+  /* Bulk conversion of the items of lists and tuples
+   *
+   * Items of the exact builtin scalar types are read in place, and only
+   * the other ones go through the generic ``from_python''. Lists of
+   * scalars also accept array.array and memoryview objects, whose
+   * contents are copied in one go.
+   */
+
+  namespace details
+  {
+    template <class T, class EnableIf = void>
+    struct item {
+      static T convert(PyObject *obj)
+      {
+        return ::from_python<T>(obj);
+      }
+    };
+
+    template <class T>
+    struct item<T, typename std::enable_if<
+                       std::is_floating_point<T>::value>::type> {
+      static T convert(PyObject *obj)
+      {
+        return PyFloat_CheckExact(obj) ? PyFloat_AS_DOUBLE(obj)
+                                       : ::from_python<T>(obj);
+      }
+    };
+
+#if PY_MAJOR_VERSION < 3
+    template <class T>
+    struct item<T, typename std::enable_if<
+                       std::is_integral<T>::value &&
+                       !std::is_same<T, bool>::value>::type> {
+      static T convert(PyObject *obj)
+      {
+        return PyInt_CheckExact(obj) ? PyInt_AS_LONG(obj)
+                                     : ::from_python<T>(obj);
+      }
+    };
+#endif
+  }
+
+  // convert the ``n'' objects at ``items'' to ``out''
+  template <class T, class O>
+  void convert_items(PyObject *const *items, Py_ssize_t n, O out)
+  {
+    for (Py_ssize_t i = 0; i < n; ++i, ++out)
+      *out = details::item<T>::convert(items[i]);
+  }
+
+  /* Contents of an array.array or a memoryview of one dimension with a
+   * native numeric format.
+   */
+  class typed_buffer
+  {
+  public:
+    // whether ``obj'' is an array.array or a memoryview
+    static bool supports(PyObject *obj)
+    {
+      return PyMemoryView_Check(obj) ||
+             strcmp(Py_TYPE(obj)->tp_name, "array.array") == 0;
+    }
+
+    explicit typed_buffer(PyObject *obj) : kind_(0)
+    {
+      if (PyObject_GetBuffer(obj, &view, PyBUF_ND | PyBUF_FORMAT) != 0) {
+        PyErr_Clear();
+        return;
+      }
+      char const *format = view.format ? view.format : "B";
+      if (*format == '@')
+        ++format;
+      if (view.ndim == 1 && format[0] && !format[1])
+        kind_ = kind_of(format[0], view.itemsize);
+      if (!kind_)
+        PyBuffer_Release(&view);
+    }
+
+    ~typed_buffer()
+    {
+      if (kind_)
+        PyBuffer_Release(&view);
+    }
+
+    typed_buffer(typed_buffer const &) = delete;
+
+    /* 'i', 'u', 'f' or 'b' for signed, unsigned, floating point or boolean
+     * items, 0 if the buffer is not usable.
+     */
+    char kind() const
+    {
+      return kind_;
+    }
+
+    // size of an item in bytes, 0 if the buffer is not usable
+    Py_ssize_t itemsize() const
+    {
+      return kind_ ? view.itemsize : 0;
+    }
+
+    /* whether the items are the Python objects a list of ``T'' holds, and
+     * ``T'' represents all their values, so that none would wrap around
+     */
+    template <class T>
+    bool holds() const
+    {
+      return kind_ && std::is_arithmetic<T>::value &&
+             (kind_ == 'f') == std::is_floating_point<T>::value &&
+             (kind_ == 'b') == std::is_same<T, bool>::value &&
+             (kind_ == 'f' || kind_ == 'b' || represents<T>());
+    }
+
+    Py_ssize_t size() const
+    {
+      return view.shape[0];
+    }
+
+    // copy the items to ``out'', with memcpy if they are ``T'' already
+    template <class T, class O>
+    typename std::enable_if<std::is_arithmetic<T>::value>::type
+    copy_to(O out) const
+    {
+      switch (kind_) {
+      case 'i':
+        return view.itemsize == 1
+                   ? copy<int8_t>(out)
+                   : view.itemsize == 2
+                         ? copy<int16_t>(out)
+                         : view.itemsize == 4 ? copy<int32_t>(out)
+                                              : copy<int64_t>(out);
+      case 'u':
+        return view.itemsize == 1
+                   ? copy<uint8_t>(out)
+                   : view.itemsize == 2
+                         ? copy<uint16_t>(out)
+                         : view.itemsize == 4 ? copy<uint32_t>(out)
+                                              : copy<uint64_t>(out);
+      case 'f':
+        return view.itemsize == 4 ? copy<float>(out)
+                                  : copy<double>(out);
+      case 'b':
+        return copy<bool>(out);
+      }
+    }
+
+    // buffers never hold other items
+    template <class T, class O>
+    typename std::enable_if<!std::is_arithmetic<T>::value>::type
+    copy_to(O) const
+    {
+    }
+
+  private:
+    static char kind_of(char format, Py_ssize_t itemsize)
+    {
+      switch (format) {
+      case 'b':
+      case 'h':
+      case 'i':
+      case 'l':
+      case 'q':
+      case 'n':
+        return 'i';
+      case 'B':
+      case 'H':
+      case 'I':
+      case 'L':
+      case 'Q':
+      case 'N':
+        return 'u';
+      case 'f':
+      case 'd':
+        return 'f';
+      case '?':
+        return itemsize == 1 ? 'b' : 0;
+      default:
+        return 0;
+      }
+    }
+
+    // whether ``T'' represents every integer of the item type
+    template <class T>
+    bool represents() const
+    {
+      Py_ssize_t const size = sizeof(T);
+      if (kind_ == 'u')
+        return view.itemsize < size + !std::is_signed<T>::value;
+      return std::is_signed<T>::value && view.itemsize <= size;
+    }
+
+    template <class S, class O>
+    void copy(O out) const
+    {
+      S const *data = static_cast<S const *>(view.buf);
+      std::copy(data, data + size(), out);
+    }
+
+    Py_buffer view;
+    char kind_;
+  };
+}
+PYTHONIC_NS_END
+
+#endif
+
+#endif
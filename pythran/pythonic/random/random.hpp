@@ -4,8 +4,19 @@
 #include "pythonic/include/random/random.hpp"
 
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/unit_state.hpp"
 #include <random>
 
+#ifndef PYTHRAN_EXTERN_UNIT_STATE
+namespace pythonic_shared
+{
+  namespace random
+  {
+    std::mt19937 __random_generator;
+  }
+}
+#endif
+
 PYTHONIC_NS_BEGIN
 
 namespace random
@@ -9,6 +9,7 @@
 #include "pythonic/utils/reserve.hpp"
 #include "pythonic/__builtin__/None.hpp"
 #include "pythonic/utils/shared_ref.hpp"
+#include "pythonic/utils/flat_hash_map.hpp"
 
 #include <memory>
 #include <utility>
@@ -428,7 +429,8 @@ namespace types
   template <class K, class V>
   std::tuple<K, V> dict<K, V>::popitem()
   {
-    auto b = data->begin();
+    // as in Python, the last inserted item is popped first
+    auto b = data->back();
     if (b == data->end())
       throw std::range_error("KeyError");
     else {
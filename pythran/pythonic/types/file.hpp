@@ -20,6 +20,8 @@
 #include <string>
 #include <cstdio>
 #include <unistd.h>
+#include <sys/stat.h>
+#include <cerrno>
 
 PYTHONIC_NS_BEGIN
 
@@ -28,13 +30,14 @@ namespace types
 
   /// _file implementation
 
-  _file::_file() : f(nullptr)
+  _file::_file() : f(nullptr), buffered(false), at_eof(false)
   {
   }
 
   // TODO : no check on file existance?
   _file::_file(types::str const &filename, types::str const &strmode)
-      : f(fopen(filename.c_str(), strmode.c_str()))
+      : f(fopen(filename.get_data().c_str(), strmode.get_data().c_str())),
+        buffered(strmode.find_first_of("wa+") == -1), at_eof(false)
   {
   }
 
@@ -51,6 +54,8 @@ namespace types
 
   /// file implementation
 
+  const long file::chunk_size;
+
   // Constructors
   file::file() : data(utils::no_memory())
   {
@@ -76,7 +81,8 @@ namespace types
   // Modifiers
   void file::open(types::str const &filename, types::str const &strmode)
   {
-    const char *smode = strmode.c_str();
+    std::string const mode = strmode.get_data();
+    const char *smode = mode.c_str();
     // Python enforces that the mode, after stripping 'U', begins with 'r',
     // 'w' || 'a'.
     if (*smode == 'U') {
@@ -93,6 +99,7 @@ namespace types
   {
     fclose(**data);
     data->f = nullptr;
+    data->buffer = types::str();
     is_open = false;
   }
 
@@ -120,6 +127,8 @@ namespace types
 
   bool file::eof()
   {
+    if (data->buffered)
+      return data->buffer.empty() && data->at_eof;
     return ::feof(**data);
   }
 
@@ -148,7 +157,7 @@ namespace types
   {
     if (!is_open)
       throw ValueError("I/O operation on closed file");
-    if (feof(**data) && mode.find_first_of("ra") == -1)
+    if (eof() && mode.find_first_of("ra") == -1)
       // If we are at eof on reading mode throw exception
       throw StopIteration("file.next() : EOF reached.");
     return readline();
@@ -160,8 +169,38 @@ namespace types
       throw ValueError("I/O operation on closed file");
     if (mode.find_first_of("r+") == -1)
       throw IOError("File ! open for reading");
-    if (size == 0 || (feof(**data) && mode.find_first_of("ra") == -1))
+    if (size == 0 || (eof() && mode.find_first_of("ra") == -1))
       return types::str();
+    if (data->buffered) {
+      types::str &buffer = data->buffer;
+      if (size > 0 && size <= buffer.size()) {
+        types::str res = buffer.substr(0, size);
+        buffer = buffer.substr(size);
+        return res;
+      }
+      // the rest of a regular file is read at once, in its final buffer,
+      // other files are read chunk by chunk up to their end
+      struct stat st;
+      bool const regular = fstat(fileno(), &st) == 0 && S_ISREG(st.st_mode);
+      long want = chunk_size;
+      if (size > 0)
+        want = size - buffer.size();
+      else if (regular)
+        want = std::max<long>(st.st_size - lseek(fileno(), 0, SEEK_CUR), 0);
+      std::string out(buffer.chars(), buffer.size());
+      buffer = types::str();
+      while (want > 0) {
+        size_t const old = out.size();
+        out.resize(old + want);
+        long const n = read_some(&out[old], want);
+        out.resize(old + n);
+        if (n == 0)
+          break;
+        if (size > 0 || regular)
+          want -= n;
+      }
+      return {std::move(out)};
+    }
     int curr_pos = tell();
     seek(0, SEEK_END);
     size = size < 0 ? tell() - curr_pos : size;
@@ -180,6 +219,26 @@ namespace types
       throw ValueError("I/O operation on closed file");
     if (mode.find_first_of("r+") == -1)
       throw IOError("File ! open for reading");
+    if (data->buffered) {
+      types::str &buffer = data->buffer;
+      long scanned = 0, length = -1;
+      while (length < 0) {
+        long const limit = std::min<long>(buffer.size(), size);
+        if (auto nl = static_cast<char const *>(
+                memchr(buffer.chars() + scanned, '\n', limit - scanned)))
+          length = nl + 1 - buffer.chars();
+        else if (limit == size)
+          length = size;
+        else {
+          scanned = limit;
+          if (!fill_buffer())
+            length = buffer.size();
+        }
+      }
+      types::str res = buffer.substr(0, length);
+      buffer = buffer.substr(length);
+      return res;
+    }
     constexpr static long BUFFER_SIZE = 1024;
     types::str res;
     char read_str[BUFFER_SIZE];
@@ -211,16 +270,54 @@ namespace types
       throw ValueError("I/O operation on closed file");
     if (whence != SEEK_SET && whence != SEEK_CUR && whence != SEEK_END)
       throw IOError("file.seek() :  Invalid argument.");
-    fseek(**data, offset, whence);
+    if (data->buffered) {
+      // the descriptor is ahead of the buffer
+      if (whence == SEEK_CUR)
+        offset -= data->buffer.size();
+      data->buffer = types::str();
+      data->at_eof = false;
+      lseek(fileno(), offset, whence);
+    } else
+      fseek(**data, offset, whence);
   }
 
   int file::tell() const
   {
     if (!is_open)
       throw ValueError("I/O operation on closed file");
+    if (data->buffered)
+      return lseek(fileno(), 0, SEEK_CUR) - data->buffer.size();
     return ftell(**data);
   }
 
+  long file::read_some(char *out, long n)
+  {
+    ssize_t res;
+    while ((res = ::read(fileno(), out, n)) < 0 && errno == EINTR)
+      ;
+    if (res < 0)
+      throw IOError(strerror(errno));
+    if (res == 0 && n > 0)
+      data->at_eof = true;
+    return res;
+  }
+
+  bool file::fill_buffer()
+  {
+    // lines longer than a chunk double the buffer, rather than growing it
+    // chunk by chunk
+    types::str &buffer = data->buffer;
+    long const n = std::max<long>(chunk_size, buffer.size());
+    std::string chunk;
+    chunk.reserve(buffer.size() + n);
+    chunk.append(buffer.chars(), buffer.size());
+    chunk.resize(buffer.size() + n);
+    long const res = read_some(&chunk[buffer.size()], n);
+    chunk.resize(buffer.size() + res);
+    buffer = types::str(std::move(chunk));
+    return res != 0;
+  }
+
   void file::truncate(int size)
   {
     if (!is_open)
@@ -240,7 +337,7 @@ namespace types
       throw ValueError("I/O operation on closed file");
     if (mode.find_first_of("wa+") == -1)
       throw IOError("file.write() :  File ! opened for writing.");
-    fwrite(str.c_str(), sizeof(char), str.size(), **data);
+    fwrite(str.chars(), sizeof(char), str.size(), **data);
   }
 
   template <class T>
@@ -257,7 +354,7 @@ namespace types
   // for line in open("myfile"):
   //     print line
   file_iterator::file_iterator(file &ref)
-      : f(ref), curr(ref.readline()), position(ref.tell())
+      : f(ref), curr(ref.readline()), position(curr ? 0 : -1)
   {
   }
 
@@ -283,11 +380,10 @@ namespace types
 
   file_iterator &file_iterator::operator++()
   {
-    // Check if ftell == -1 when fgetpos(FILE *stream, fpos_t eof) == 0
-    if (f.eof())
-      return *this;
+    // only the end of the file gives an empty line, and pipes have no
+    // position to compare
     curr = f.readline();
-    position = f.eof() ? -1 : f.tell();
+    position = curr ? position + 1 : -1;
     return *this;
   }
 
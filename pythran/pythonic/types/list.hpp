@@ -716,6 +716,8 @@ namespace std
 
 #ifdef ENABLE_PYTHON_MODULE
 
+#include "pythonic/python/sequence.hpp"
+
 PYTHONIC_NS_BEGIN
 template <class T>
 PyObject *to_python<types::list<T>>::convert(types::list<T> const &v)
@@ -745,21 +747,26 @@ PyObject *to_python<types::empty_list>::convert(types::empty_list const &)
 template <class T>
 bool from_python<types::list<T>>::is_convertible(PyObject *obj)
 {
-  return PyList_Check(obj) &&
-         (PyObject_Not(obj) ||
-          ::is_convertible<T>(PySequence_Fast_GET_ITEM(obj, 0)));
+  if (PyList_Check(obj))
+    return PyObject_Not(obj) ||
+           ::is_convertible<T>(PySequence_Fast_GET_ITEM(obj, 0));
+  return std::is_arithmetic<T>::value && python::typed_buffer::supports(obj) &&
+         python::typed_buffer(obj).holds<T>();
 }
 
 template <class T>
 types::list<T> from_python<types::list<T>>::convert(PyObject *obj)
 {
+  if (!PyList_Check(obj)) {
+    python::typed_buffer buffer(obj);
+    types::list<T> v(buffer.size());
+    buffer.copy_to<T>(v.begin());
+    return v;
+  }
+
   Py_ssize_t l = PySequence_Fast_GET_SIZE(obj);
   types::list<T> v(l);
-
-  PyObject **core = PySequence_Fast_ITEMS(obj);
-  std::transform(core, core + l, v.begin(),
-                 [](PyObject *o) { return ::from_python<T>(o); });
-
+  python::convert_items<T>(PySequence_Fast_ITEMS(obj), l, v.begin());
   return v;
 }
 PYTHONIC_NS_END
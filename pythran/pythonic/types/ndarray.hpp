@@ -12,6 +12,8 @@
 #include "pythonic/utils/reserve.hpp"
 #include "pythonic/utils/int_.hpp"
 #include "pythonic/utils/broadcast_copy.hpp"
+#include "pythonic/utils/gather_scatter.hpp"
+#include "pythonic/utils/stream_compaction.hpp"
 
 #include "pythonic/types/slice.hpp"
 #include "pythonic/types/tuple.hpp"
@@ -648,13 +650,7 @@ namespace types
   {
     static_assert(F::value == 1,
                   "advanced indexing only supporint with 1D index");
-    array<long, N> shape = this->shape();
-    shape[0] = filter.flat_size();
-    ndarray<T, N> out(shape, none_type());
-    std::transform(
-        filter.begin(), filter.end(), out.begin(),
-        [this](typename F::dtype index) { return operator[](index); });
-    return out;
+    return fast(filter);
   }
 
   template <class T, size_t N>
@@ -667,11 +663,14 @@ namespace types
   {
     static_assert(F::value == 1,
                   "advanced indexing only supporint with 1D index");
+    auto const &indices = utils::dense(filter);
     array<long, N> shape = this->shape();
-    shape[0] = filter.flat_size();
+    long const size = shape[0];
+    shape[0] = indices.flat_size();
     ndarray<T, N> out(shape, none_type());
-    std::transform(filter.begin(), filter.end(), out.begin(),
-                   [this](typename F::dtype index) { return fast(index); });
+    long const block = std::accumulate(shape.begin() + 1, shape.end(), 1L,
+                                       std::multiplies<long>());
+    utils::gather(out.buffer, buffer, size, block, indices.buffer, shape[0]);
     return out;
   }
 
@@ -1286,12 +1285,30 @@ to_python<types::ndarray<T, N>>::convert(types::ndarray<T, N> const &cn,
   } else {
     PyObject *result = pyarray_new<long, N>{}.from_data(
         n._shape.data(), c_type_to_numpy_type<T>::value, n.buffer);
-    n.mark_memory_external(result);
-    Py_INCREF(result);
-    if (!result)
-      return nullptr;
-    PyArray_ENABLEFLAGS(reinterpret_cast<PyArrayObject *>(result),
-                        NPY_ARRAY_OWNDATA);
+    if (n.mem->mapped()) {
+      if (!result)
+        return nullptr;
+      // numpy cannot release a mapping, so the array holds a reference to
+      // the memory through its base object instead
+      using mem_type = utils::shared_ref<types::raw_array<T>>;
+      PyObject *base = PyCapsule_New(new mem_type(n.mem), nullptr,
+                                     [](PyObject *capsule) {
+                                       delete static_cast<mem_type *>(
+                                           PyCapsule_GetPointer(capsule,
+                                                                nullptr));
+                                     });
+      PyArray_SetBaseObject(reinterpret_cast<PyArrayObject *>(result), base);
+      if (!n.mem->writable())
+        PyArray_CLEARFLAGS(reinterpret_cast<PyArrayObject *>(result),
+                           NPY_ARRAY_WRITEABLE);
+    } else {
+      n.mark_memory_external(result);
+      Py_INCREF(result);
+      if (!result)
+        return nullptr;
+      PyArray_ENABLEFLAGS(reinterpret_cast<PyArrayObject *>(result),
+                          NPY_ARRAY_OWNDATA);
+    }
     if (transpose)
       return PyArray_Transpose(reinterpret_cast<PyArrayObject *>(result),
                                nullptr);
@@ -4,6 +4,7 @@
 #include "pythonic/include/types/numpy_fexpr.hpp"
 
 #include "pythonic/types/nditerator.hpp"
+#include "pythonic/utils/stream_compaction.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -12,34 +13,15 @@ namespace types
 
   template <class Arg, class F>
   numpy_fexpr<Arg, F>::numpy_fexpr(Arg const &arg, F const &filter)
-      : arg(arg), indices(arg.flat_size()), buffer(indices->data)
-  {
-    auto iter = buffer;
-    long index = 0;
-    _copy_mask(filter.begin(), filter.end(), iter, index,
-               utils::int_<std::remove_reference<
-                   typename std::remove_cv<Arg>::type>::type::value>());
-    _shape[0] = {static_cast<long>(iter - buffer)};
-  }
-
-  template <class Arg, class F>
-  template <class FIter, class O>
-  void numpy_fexpr<Arg, F>::_copy_mask(FIter fiter, FIter fend, O &out,
-                                       long &index, utils::int_<1>)
-  {
-    for (; fiter != fend; ++fiter, ++index)
-      if (*fiter)
-        *out++ = index;
-  }
-
-  template <class Arg, class F>
-  template <class FIter, class O, size_t N>
-  void numpy_fexpr<Arg, F>::_copy_mask(FIter fiter, FIter fend, O &out,
-                                       long &index, utils::int_<N>)
-  {
-    for (; fiter != fend; ++fiter)
-      _copy_mask((*fiter).begin(), (*fiter).end(), out, index,
-                 utils::int_<N - 1>());
+      : arg(arg)
+  {
+    auto const &mask = utils::dense(filter);
+    utils::nonzero_compaction<bool> compaction(mask.buffer, mask.flat_size());
+    indices = utils::shared_ref<raw_array<long>>(compaction.size());
+    buffer = indices->data;
+    long *out = buffer;
+    compaction([out](long k, long i) { out[k] = i; });
+    _shape[0] = compaction.size();
   }
 
   template <class Arg, class F>
@@ -3,6 +3,10 @@
 
 #include "pythonic/include/types/raw_array.hpp"
 
+#include "pythonic/utils/allocate.hpp"
+
+#include <cstdlib>
+
 PYTHONIC_NS_BEGIN
 
 namespace types
@@ -13,25 +17,33 @@ namespace types
    */
   template <class T>
   raw_array<T>::raw_array()
-      : data(nullptr), external(false)
+      : data(nullptr), owner(ownership::owned), nbytes(0), unmap(nullptr)
   {
   }
 
   template <class T>
   raw_array<T>::raw_array(size_t n)
-      : data((T *)malloc(n * sizeof(T))), external(false)
+      : data((T *)utils::allocate(n * sizeof(T))), owner(ownership::owned),
+        nbytes(n * sizeof(T)), unmap(nullptr)
   {
   }
 
   template <class T>
   raw_array<T>::raw_array(T *d, ownership o)
-      : data(d), external(o == ownership::external)
+      : data(d), owner(o), nbytes(0), unmap(nullptr)
+  {
+  }
+
+  template <class T>
+  raw_array<T>::raw_array(T *d, size_t n, ownership o,
+                          void (*unmap)(T *, size_t))
+      : data(d), owner(o), nbytes(n), unmap(unmap)
   {
   }
 
   template <class T>
   raw_array<T>::raw_array(raw_array<T> &&d)
-      : data(d.data), external(d.external)
+      : data(d.data), owner(d.owner), nbytes(d.nbytes), unmap(d.unmap)
   {
     d.data = nullptr;
   }
@@ -39,14 +51,41 @@ namespace types
   template <class T>
   raw_array<T>::~raw_array()
   {
-    if (data && !external)
-      free(data);
+    if (!data)
+      return;
+    switch (owner) {
+    case ownership::owned:
+      if (nbytes)
+        utils::deallocate(data, nbytes);
+      else
+        free(data);
+      break;
+    case ownership::mapped:
+    case ownership::mapped_read_only:
+      unmap(data, nbytes);
+      break;
+    case ownership::external:
+      break;
+    }
   }
 
   template <class T>
   void raw_array<T>::forget()
   {
-    external = true;
+    owner = ownership::external;
+  }
+
+  template <class T>
+  bool raw_array<T>::mapped() const
+  {
+    return owner == ownership::mapped ||
+           owner == ownership::mapped_read_only;
+  }
+
+  template <class T>
+  bool raw_array<T>::writable() const
+  {
+    return owner != ownership::mapped_read_only;
   }
 }
 PYTHONIC_NS_END
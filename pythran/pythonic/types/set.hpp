@@ -7,13 +7,13 @@
 #include "pythonic/types/empty_iterator.hpp"
 #include "pythonic/types/list.hpp"
 
+#include "pythonic/utils/flat_hash_set.hpp"
 #include "pythonic/utils/iterator.hpp"
 #include "pythonic/utils/reserve.hpp"
 #include "pythonic/utils/shared_ref.hpp"
 
 #include "pythonic/__builtin__/in.hpp"
 
-#include <set>
 #include <memory>
 #include <utility>
 #include <limits>
@@ -36,9 +36,8 @@ namespace types
   template <class T>
   template <class InputIterator>
   set<T>::set(InputIterator start, InputIterator stop)
-      : data()
+      : data(start, stop)
   {
-    std::copy(start, stop, std::back_inserter(*this));
   }
 
   template <class T>
@@ -49,7 +48,7 @@ namespace types
 
   template <class T>
   set<T>::set(std::initializer_list<value_type> l)
-      : data(std::move(l))
+      : data(l.begin(), l.end())
   {
   }
 
@@ -62,9 +61,8 @@ namespace types
   template <class T>
   template <class F>
   set<T>::set(set<F> const &other)
-      : data()
+      : data(other.begin(), other.end())
   {
-    std::copy(other.begin(), other.end(), std::inserter(*data, data->begin()));
   }
 
   // iterators
@@ -92,30 +90,6 @@ namespace types
     return data->end();
   }
 
-  template <class T>
-  typename set<T>::reverse_iterator set<T>::rbegin()
-  {
-    return data->rbegin();
-  }
-
-  template <class T>
-  typename set<T>::const_reverse_iterator set<T>::rbegin() const
-  {
-    return data->rbegin();
-  }
-
-  template <class T>
-  typename set<T>::reverse_iterator set<T>::rend()
-  {
-    return data->rend();
-  }
-
-  template <class T>
-  typename set<T>::const_reverse_iterator set<T>::rend() const
-  {
-    return data->rend();
-  }
-
   // modifiers
   template <class T>
   T set<T>::pop()
@@ -123,9 +97,7 @@ namespace types
     if (size() <= 0)
       throw std::out_of_range("Trying to pop() an empty set.");
 
-    T tmp = *begin();
-    data->erase(begin());
-    return tmp;
+    return data->pop();
   }
 
   template <class T>
@@ -183,7 +155,9 @@ namespace types
   template <class T>
   set<T> set<T>::copy() const
   {
-    return set<T>(begin(), end());
+    set<T> tmp = empty_set();
+    *tmp.data = *data;
+    return tmp;
   }
 
   template <class T>
@@ -198,6 +172,12 @@ namespace types
     return true;
   }
 
+  template <class T>
+  bool set<T>::isdisjoint(set<T> const &other) const
+  {
+    return data->is_disjoint_from(*other.data);
+  }
+
   template <class T>
   template <class U>
   bool set<T>::issubset(U const &other) const
@@ -210,6 +190,12 @@ namespace types
     return true;
   }
 
+  template <class T>
+  bool set<T>::issubset(set<T> const &other) const
+  {
+    return data->is_subset_of(*other.data);
+  }
+
   template <class T>
   template <class U>
   bool set<T>::issuperset(U const &other) const
@@ -221,7 +207,7 @@ namespace types
   template <class T>
   set<T> set<T>::union_() const
   {
-    return set<T>(begin(), end());
+    return copy();
   }
 
   template <class T>
@@ -231,7 +217,7 @@ namespace types
   {
     typename __combined<set<T>, U, Types...>::type tmp =
         union_(std::forward<Types...>(others)...);
-    tmp.data->insert(other.begin(), other.end());
+    tmp.merge(other);
     return tmp;
   }
 
@@ -239,14 +225,14 @@ namespace types
   template <typename... Types>
   none_type set<T>::update(Types &&... others)
   {
-    *this = union_(std::forward<Types>(others)...);
+    (void)std::initializer_list<int>{(merge(others), 0)...};
     return {};
   }
 
   template <class T>
   set<T> set<T>::intersection() const
   {
-    return set<T>(begin(), end());
+    return copy();
   }
 
   template <class T>
@@ -257,11 +243,7 @@ namespace types
     // Return a new set with elements common to the set && all others.
     typename __combined<set<T>, U, Types...>::type tmp =
         intersection(others...);
-    for (auto it = tmp.begin(); it != tmp.end(); ++it) {
-      if (!in(other, *it))
-        tmp.discard(
-            *it); // faster than remove() but ! direct interaction with data
-    }
+    tmp.retain(other);
     return tmp;
   }
 
@@ -269,13 +251,13 @@ namespace types
   template <typename... Types>
   void set<T>::intersection_update(Types const &... others)
   {
-    *this = intersection(others...);
+    (void)std::initializer_list<int>{(retain(others), 0)...};
   }
 
   template <class T>
   set<T> set<T>::difference() const
   {
-    return set<T>(begin(), end());
+    return copy();
   }
 
   template <class T>
@@ -284,17 +266,7 @@ namespace types
   {
     // Return a new set with elements in the set that are ! in the others.
     set<T> tmp = difference(others...);
-    /*
-                   for(iterator it=tmp.begin(); it!=tmp.end();++it){
-                   if(other.get_data().find(*it)!=other.end())
-                   tmp.discard(*it);
-                   }
-                   */ // This algo will do several times the same find(), because
-       // std::set::erase() calls find. Lame!
-    for (typename U::const_iterator it = other.begin(); it != other.end();
-         ++it) {
-      tmp.discard(*it);
-    }
+    tmp.subtract(other);
     return tmp;
   }
 
@@ -302,14 +274,14 @@ namespace types
   template <class V>
   bool set<T>::contains(V const &v) const
   {
-    return data->find(v) != data->end();
+    return data->contains(v);
   }
 
   template <class T>
   template <typename... Types>
   void set<T>::difference_update(Types const &... others)
   {
-    *this = difference(others...);
+    (void)std::initializer_list<int>{(subtract(others), 0)...};
   }
 
   template <class T>
@@ -350,7 +322,7 @@ namespace types
   template <class U>
   bool set<T>::operator==(set<U> const &other) const
   {
-    return *data == *other.data;
+    return size() == other.size() && issubset(other);
   }
 
   template <class T>
@@ -450,6 +422,50 @@ namespace types
     return reinterpret_cast<intptr_t>(&(*data));
   }
 
+  template <class T>
+  template <class U>
+  void set<T>::merge(U const &other)
+  {
+    data->insert(other.begin(), other.end());
+  }
+
+  template <class T>
+  void set<T>::merge(set<T> const &other)
+  {
+    data->merge(*other.data);
+  }
+
+  template <class T>
+  template <class U>
+  void set<T>::retain(U const &other)
+  {
+    container_type kept;
+    for (auto const &e : *data)
+      if (in(other, e))
+        kept.insert(e);
+    *data = std::move(kept);
+  }
+
+  template <class T>
+  void set<T>::retain(set<T> const &other)
+  {
+    data->intersect(*other.data);
+  }
+
+  template <class T>
+  template <class U>
+  void set<T>::subtract(U const &other)
+  {
+    for (auto const &e : other)
+      data->erase(e);
+  }
+
+  template <class T>
+  void set<T>::subtract(set<T> const &other)
+  {
+    data->subtract(*other.data);
+  }
+
   template <class T>
   std::ostream &operator<<(std::ostream &os, set<T> const &v)
   {
@@ -10,8 +10,11 @@
 #include "pythonic/utils/shared_ref.hpp"
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/utils/int_.hpp"
+#include "pythonic/utils/str_search.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <string>
 #include <cstring>
 #include <sstream>
@@ -97,6 +100,8 @@ namespace types
                             typename S::normalized_type const &s)
       : data(other.data), slicing(s)
   {
+    slicing.lower += other.offset;
+    slicing.upper += other.offset;
   }
 
   // const getter
@@ -112,6 +117,24 @@ namespace types
     return slicing;
   }
 
+  template <class S>
+  char const *sliced_str<S>::chars() const
+  {
+    assert(slicing.step == 1 && "strided slices have no character range");
+    return data->data() + slicing.lower;
+  }
+
+  template <class S>
+  auto sliced_str<S>::c_str() -> decltype(data->c_str())
+  {
+    // only a contiguous suffix of the buffer is null terminated
+    if (slicing.step != 1 || slicing.upper != (long)data->size()) {
+      data = utils::shared_ref<container_type>(begin(), end());
+      slicing = typename S::normalized_type(0, data->size());
+    }
+    return data->c_str() + slicing.lower;
+  }
+
   // iterators
   template <class S>
   typename sliced_str<S>::const_iterator sliced_str<S>::begin() const
@@ -123,8 +146,11 @@ namespace types
   template <class S>
   typename sliced_str<S>::const_iterator sliced_str<S>::end() const
   {
-    return typename sliced_str<S>::const_iterator(data->c_str() + slicing.upper,
-                                                  slicing.step);
+    // ``upper'' is not reached from ``lower'' when the step does not divide
+    // their distance
+    return typename sliced_str<S>::const_iterator(
+        data->c_str() + slicing.lower + slicing.size() * slicing.step,
+        slicing.step);
   }
 
   // size
@@ -218,15 +244,15 @@ namespace types
   template <class S>
   str sliced_str<S>::operator+(sliced_str<S> const &s)
   {
-    str out(*data);
-    std::copy(s.begin(), s.end(), std::copy(begin(), end(), out.begin()));
+    str out(*this);
+    out += s;
     return out;
   }
 
   template <class S>
   size_t sliced_str<S>::find(str const &s, size_t pos) const
   {
-    return str(*this).find(s); // quite inefficient
+    return str(*this).find(s, pos); // no copy for contiguous slices
   }
 
   template <class S>
@@ -242,63 +268,95 @@ namespace types
   {
     if (slicing.step == 1) {
       data->erase(slicing.lower, slicing.upper);
-      data->insert(slicing.lower, s.get_data());
+      data->insert(slicing.lower, s.chars(), s.size());
     } else
       assert("! implemented yet");
     return *this;
   }
 
   /// str implementation
-  str::str() : data()
+  str::str() : data(), offset(0), length(0)
   {
   }
 
-  str::str(std::string const &s) : data(s)
+  str::str(std::string const &s) : data(s), offset(0), length(s.size())
   {
   }
 
-  str::str(std::string &&s) : data(std::move(s))
+  str::str(std::string &&s) : data(std::move(s)), offset(0)
   {
+    length = data->size();
   }
 
-  str::str(const char *s) : data(s)
+  str::str(const char *s) : data(s), offset(0)
   {
+    length = data->size();
   }
 
-  str::str(const char *s, size_t n) : data(s, n)
+  str::str(const char *s, size_t n) : data(s, n), offset(0), length(n)
   {
   }
 
-  str::str(char c) : data(1, c)
+  str::str(char c) : data(1, c), offset(0), length(1)
   {
   }
 
   template <class S>
   str::str(sliced_str<S> const &other)
-      : data(other.begin(), other.end())
+      : data(utils::no_memory()), offset(0), length(other.size())
   {
+    if (other.get_slice().step == 1) {
+      // a contiguous slice is a view on the same buffer
+      data = other.data;
+      offset = other.get_slice().lower;
+    } else
+      data = utils::shared_ref<container_type>(other.begin(), other.end());
   }
 
   template <class T>
   str::str(T const &begin, T const &end)
-      : data(begin, end)
+      : data(begin, end), offset(0)
+  {
+    length = data->size();
+  }
+
+  void str::own()
   {
+    if (offset != 0 || length != data->size()) {
+      data = utils::shared_ref<container_type>(data->data() + offset, length);
+      offset = 0;
+    }
+  }
+
+  bool str::is_suffix() const
+  {
+    return offset + length == data->size();
+  }
+
+  int str::compare_chars(char const *s, size_t n, char const *t, size_t m)
+  {
+    if (int res = memcmp(s, t, std::min(n, m)))
+      return res;
+    return n < m ? -1 : (n > m ? 1 : 0);
   }
 
   str::operator char() const
   {
     assert(size() == 1);
-    return (*data)[0];
+    return fast(0);
   }
 
   str::operator long int() const
   { // Allows implicit conversion without loosing bool conversion
+    // strtol needs a null terminated string
+    std::string tmp;
+    auto dat = is_suffix() ? chars()
+                           : (tmp.assign(chars(), length), tmp.c_str());
     char *endptr;
-    auto dat = data->data();
     long res = strtol(dat, &endptr, 10);
     if (endptr == dat) {
       std::ostringstream err;
-      err << "invalid literal for long() with base 10:'" << c_str() << '\'';
+      err << "invalid literal for long() with base 10:'" << *this << '\'';
       throw std::runtime_error(err.str());
     }
     return res;
@@ -307,14 +365,16 @@ namespace types
   str::operator pythran_long_t() const
   {
 #ifdef USE_GMP
-    return pythran_long_t(*data);
+    return pythran_long_t(get_data());
 #else
+    std::string tmp;
+    auto dat = is_suffix() ? chars()
+                           : (tmp.assign(chars(), length), tmp.c_str());
     char *endptr;
-    auto dat = data->data();
     pythran_long_t res = strtoll(dat, &endptr, 10);
     if (endptr == dat) {
       std::ostringstream err;
-      err << "invalid literal for long() with base 10:'" << c_str() << '\'';
+      err << "invalid literal for long() with base 10:'" << *this << '\'';
       throw std::runtime_error(err.str());
     }
     return res;
@@ -323,12 +383,14 @@ namespace types
 
   str::operator double() const
   {
+    std::string tmp;
+    auto dat = is_suffix() ? chars()
+                           : (tmp.assign(chars(), length), tmp.c_str());
     char *endptr;
-    auto dat = data->data();
     double res = strtod(dat, &endptr);
     if (endptr == dat) {
       std::ostringstream err;
-      err << "invalid literal for double():'" << c_str() << "'";
+      err << "invalid literal for double():'" << *this << "'";
       throw std::runtime_error(err.str());
     }
     return res;
@@ -337,84 +399,92 @@ namespace types
   template <class S>
   str &str::operator=(sliced_str<S> const &other)
   {
-    if (other.get_data() == *data) {
-      auto it = std::copy(other.begin(), other.end(), begin());
-      resize(it - this->begin());
-    } else
-      *this = other.get_data();
-    return *this;
+    return *this = str(other);
   }
 
   str &str::operator+=(str const &s)
   {
-    *data += *s.data;
+    own();
+    data->append(s.chars(), s.length);
+    length = data->size();
     return *this;
   }
 
-  str::container_type const &str::get_data() const
+  str::container_type str::get_data() const
   {
-    return *data;
+    return container_type(chars(), length);
+  }
+
+  char const *str::chars() const
+  {
+    return data->data() + offset;
   }
 
   long str::size() const
   {
-    return data->size();
+    return length;
   }
 
   auto str::begin() const -> decltype(data->begin())
   {
-    return data->begin();
+    return data->begin() + offset;
   }
 
   auto str::begin() -> decltype(data->begin())
   {
-    return data->begin();
+    return data->begin() + offset;
   }
 
   auto str::rbegin() const -> decltype(data->rbegin())
   {
-    return data->rbegin();
+    return decltype(data->rbegin())(end());
   }
 
   auto str::rbegin() -> decltype(data->rbegin())
   {
-    return data->rbegin();
+    return decltype(data->rbegin())(end());
   }
 
   auto str::end() const -> decltype(data->end())
   {
-    return data->end();
+    return begin() + length;
   }
 
   auto str::end() -> decltype(data->end())
   {
-    return data->end();
+    return begin() + length;
   }
 
   auto str::rend() const -> decltype(data->rend())
   {
-    return data->rend();
+    return decltype(data->rend())(begin());
   }
 
   auto str::rend() -> decltype(data->rend())
   {
-    return data->rend();
+    return decltype(data->rend())(begin());
   }
 
-  auto str::c_str() const -> decltype(data->c_str())
+  auto str::c_str() -> decltype(data->c_str())
   {
-    return data->c_str();
+    if (!is_suffix())
+      own();
+    return data->c_str() + offset;
   }
 
   auto str::resize(long n) -> decltype(data->resize(n))
   {
-    return data->resize(n);
+    own();
+    data->resize(n);
+    length = n;
   }
 
   long str::find(str const &s, size_t pos) const
   {
-    const char *res = strstr(c_str() + pos, s.c_str());
-    return res ? res - c_str() : -1;
+    if (pos > length)
+      return -1;
+    long res = utils::find(chars() + pos, length - pos, s.chars(), s.length);
+    return res < 0 ? res : res + pos;
   }
 
   bool str::contains(str const &v) const
@@ -424,86 +494,111 @@ namespace types
 
   long str::find_first_of(str const &s, size_t pos) const
   {
-    return data->find_first_of(*s.data, pos);
+    if (pos >= length)
+      return -1;
+    long res =
+        utils::find_first_of(chars() + pos, length - pos, s.chars(), s.length);
+    return res < 0 ? res : res + pos;
   }
 
   long str::find_first_of(const char *s, size_t pos) const
   {
-    return data->find_first_of(s, pos);
+    return find_first_of(str(s), pos);
   }
 
   long str::find_first_not_of(str const &s, size_t pos) const
   {
-    return data->find_first_not_of(*s.data, pos);
+    if (pos >= length)
+      return -1;
+    long res = utils::find_first_not_of(chars() + pos, length - pos, s.chars(),
+                                        s.length);
+    return res < 0 ? res : res + pos;
   }
 
   long str::find_last_not_of(str const &s, size_t pos) const
   {
-    return data->find_last_not_of(*s.data, pos);
+    if (!length)
+      return -1;
+    return utils::find_last_not_of(chars(), std::min(pos, length - 1) + 1,
+                                   s.chars(), s.length);
   }
 
   str str::substr(size_t pos, size_t len) const
   {
-    return data->substr(pos, len);
+    if (pos > length)
+      throw std::out_of_range("str::substr");
+    str out(*this);
+    out.offset += pos;
+    out.length = std::min(len, length - pos);
+    return out;
   }
 
   bool str::empty() const
   {
-    return data->empty();
+    return length == 0;
   }
 
   int str::compare(size_t pos, size_t len, str const &str) const
   {
-    return data->compare(pos, len, *str.data);
+    pos = std::min(pos, length);
+    return compare_chars(chars() + pos, std::min(len, length - pos),
+                         str.chars(), str.length);
   }
 
   void str::reserve(size_t n)
   {
+    own();
     data->reserve(n);
   }
 
   str &str::replace(size_t pos, size_t len, str const &str)
   {
-    data->replace(pos, len, *str.data);
+    own();
+    data->replace(pos, len, str.chars(), str.length);
+    length = data->size();
     return *this;
   }
 
   template <class S>
   str &str::operator+=(sliced_str<S> const &other)
   {
-    resize(size() + other.get_data().size());
-    std::copy(other.begin(), other.end(), begin());
+    own();
+    data->reserve(length + other.size());
+    for (auto iter = other.begin(), end = other.end(); iter != end; ++iter)
+      data->push_back(*iter);
+    length = data->size();
     return *this;
   }
 
   bool str::operator==(str const &other) const
   {
-    return *data == *other.data;
+    return length == other.length &&
+           memcmp(chars(), other.chars(), length) == 0;
   }
 
   bool str::operator!=(str const &other) const
   {
-    return *data != *other.data;
+    return !(*this == other);
   }
 
   bool str::operator<=(str const &other) const
   {
-    return *data <= *other.data;
+    return compare_chars(chars(), length, other.chars(), other.length) <= 0;
   }
 
   bool str::operator<(str const &other) const
   {
-    return *data < *other.data;
+    return compare_chars(chars(), length, other.chars(), other.length) < 0;
   }
 
   bool str::operator>=(str const &other) const
   {
-    return *data >= *other.data;
+    return compare_chars(chars(), length, other.chars(), other.length) >= 0;
   }
 
   bool str::operator>(str const &other) const
   {
-    return *data > *other.data;
+    return compare_chars(chars(), length, other.chars(), other.length) > 0;
   }
 
   template <class S>
@@ -544,12 +639,12 @@ namespace types
 
   char str::fast(long i) const
   {
-    return (*data)[i];
+    return (*data)[offset + i];
   }
 
   char &str::fast(long i)
   {
-    return (*data)[i];
+    return (*data)[offset + i];
   }
 
   sliced_str<slice> str::operator[](slice const &s) const
@@ -585,7 +680,7 @@ namespace types
 
   str::operator bool() const
   {
-    return !data->empty();
+    return length != 0;
   }
 
   long str::count(types::str const &sub) const
@@ -602,7 +697,11 @@ namespace types
 
   str operator+(str const &self, str const &other)
   {
-    return str(self.get_data() + other.get_data());
+    std::string s;
+    s.reserve(self.size() + other.size());
+    s.append(self.chars(), self.size());
+    s.append(other.chars(), other.size());
+    return {std::move(s)};
   }
 
   template <size_t N>
@@ -610,7 +709,7 @@ namespace types
   {
     std::string s;
     s.reserve(self.size() + N);
-    s += self.get_data();
+    s.append(self.chars(), self.size());
     s += other;
     return {std::move(s)};
   }
@@ -621,7 +720,7 @@ namespace types
     std::string s;
     s.reserve(other.size() + N);
     s += self;
-    s += other.get_data();
+    s.append(other.chars(), other.size());
     return {std::move(s)};
   }
 
@@ -647,7 +746,7 @@ namespace types
 
   std::ostream &operator<<(std::ostream &os, str const &s)
   {
-    return os << s.c_str();
+    return os.write(s.chars(), s.size());
   }
 
   size_t hash_value(str const &x)
@@ -672,12 +771,11 @@ pythonic::types::str operator*(pythonic::types::str const &s, long n)
 {
   if (n <= 0)
     return pythonic::types::str();
-  pythonic::types::str other;
-  other.resize(s.size() * n);
-  auto where = other.begin();
-  for (long i = 0; i < n; i++, where += s.size())
-    std::copy(s.begin(), s.end(), where);
-  return other;
+  std::string other;
+  other.reserve(s.size() * n);
+  for (long i = 0; i < n; i++)
+    other.append(s.chars(), s.size());
+  return {std::move(other)};
 }
 
 pythonic::types::str operator*(long t, pythonic::types::str const &s)
@@ -691,7 +789,26 @@ namespace std
   size_t hash<pythonic::types::str>::
   operator()(const pythonic::types::str &x) const
   {
-    return hash<std::string>()(x.get_data());
+    // hashes the characters in place, a view is never copied
+    char const *p = x.chars();
+    size_t n = x.size();
+    uint64_t h = 0x9e3779b97f4a7c15ULL ^ n;
+    for (; n >= sizeof(uint64_t); n -= sizeof(uint64_t),
+                                  p += sizeof(uint64_t)) {
+      uint64_t w;
+      memcpy(&w, p, sizeof(w));
+      h = (h ^ w) * 0x87c37b91114253d5ULL;
+      h = (h << 31) | (h >> 33);
+    }
+    for (; n; --n, ++p)
+      h = (h ^ (unsigned char)*p) * 0x100000001b3ULL;
+    // murmur3 finalizer, the hash tables use the low bits
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
   }
 
   template <size_t I>
@@ -721,13 +838,15 @@ PYTHONIC_NS_BEGIN
 
 PyObject *to_python<types::str>::convert(types::str const &v)
 {
-  return PyString_FromStringAndSize(v.c_str(), v.size());
+  return PyString_FromStringAndSize(v.chars(), v.size());
 }
 
 template <class S>
 PyObject *
 to_python<types::sliced_str<S>>::convert(types::sliced_str<S> const &v)
 {
+  if (v.get_slice().step == 1)
+    return PyString_FromStringAndSize(v.chars(), v.size());
   return ::to_python(types::str(v));
 }
 PyObject *to_python<char>::convert(char l)
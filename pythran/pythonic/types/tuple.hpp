@@ -535,6 +535,7 @@ namespace std
 #include "pythonic/include/utils/seq.hpp"
 #include "pythonic/include/utils/fwd.hpp"
 #include "pythonic/python/core.hpp"
+#include "pythonic/python/sequence.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -614,9 +615,9 @@ template <size_t... S>
 std::tuple<Types...> from_python<std::tuple<Types...>>::do_convert(
     PyObject *obj, typename utils::index_sequence<S...>)
 {
-  return std::tuple<Types...>{
-      ::from_python<typename std::tuple_element<S, std::tuple<Types...>>::type>(
-          PyTuple_GET_ITEM(obj, S))...};
+  return std::tuple<Types...>{python::details::item<
+      typename std::tuple_element<S, std::tuple<Types...>>::type>::
+                                  convert(PyTuple_GET_ITEM(obj, S))...};
 }
 template <typename... Types>
 std::tuple<Types...> from_python<std::tuple<Types...>>::convert(PyObject *obj)
@@ -643,7 +644,7 @@ template <size_t... S>
 types::array<T, N> from_python<types::array<T, N>>::do_convert(
     PyObject *obj, typename utils::index_sequence<S...>)
 {
-  return {::from_python<T>(PyTuple_GET_ITEM(obj, S))...};
+  return {python::details::item<T>::convert(PyTuple_GET_ITEM(obj, S))...};
 }
 template <typename T, size_t N>
 types::array<T, N> from_python<types::array<T, N>>::
@@ -0,0 +1,138 @@
+#ifndef PYTHONIC_UTILS_ALLOCATE_HPP
+#define PYTHONIC_UTILS_ALLOCATE_HPP
+
+#include "pythonic/include/utils/allocate.hpp"
+
+#include "pythonic/utils/bits.hpp"
+#include <cstdlib>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  namespace allocate_details
+  {
+    // blocks are rounded up to a power of two, from 16 to 1024 bytes
+    static const size_t min_block_bits = 4;
+    static const size_t nclasses = 7;
+    static const size_t max_block_size = size_t(1)
+                                         << (min_block_bits + nclasses - 1);
+    // bytes a free list may hold outside of any scope
+    static const size_t max_cached_bytes = 1 << 16;
+
+    struct free_block {
+      free_block *next;
+    };
+
+    /* Thread local state, trivially destructible so that accessing it does
+     * not go through an initialization guard. Blocks still cached when the
+     * thread ends are not released.
+     */
+    struct pool {
+      free_block *free_lists[nclasses];
+      size_t cached[nclasses];
+      size_t depth;
+      allocation_counters counters;
+    };
+
+    thread_local pool local_pool;
+
+    size_t class_of(size_t n)
+    {
+      return n <= (size_t(1) << min_block_bits)
+                 ? 0
+                 : 64 - count_leading_zeros(n - 1) - min_block_bits;
+    }
+
+    size_t block_size(size_t c)
+    {
+      return size_t(1) << (min_block_bits + c);
+    }
+  }
+
+  allocation_counters const &allocation_stats()
+  {
+    return allocate_details::local_pool.counters;
+  }
+
+#ifdef PYTHRAN_POOL_ALLOCATOR
+
+  void *allocate(size_t n)
+  {
+    using namespace allocate_details;
+    pool &p = local_pool;
+    ++p.counters.allocations;
+    if (n > max_block_size)
+      return malloc(n);
+    size_t c = class_of(n);
+    if (free_block *b = p.free_lists[c]) {
+      p.free_lists[c] = b->next;
+      --p.cached[c];
+      ++p.counters.reuses;
+      return b;
+    }
+    return malloc(block_size(c));
+  }
+
+  void deallocate(void *ptr, size_t n)
+  {
+    using namespace allocate_details;
+    pool &p = local_pool;
+    ++p.counters.deallocations;
+    size_t c = class_of(n);
+    if (n > max_block_size ||
+        (!p.depth && p.cached[c] * block_size(c) >= max_cached_bytes)) {
+      free(ptr);
+      return;
+    }
+    free_block *b = static_cast<free_block *>(ptr);
+    b->next = p.free_lists[c];
+    p.free_lists[c] = b;
+    ++p.cached[c];
+  }
+
+#else
+
+  void *allocate(size_t n)
+  {
+    ++allocate_details::local_pool.counters.allocations;
+    return malloc(n);
+  }
+
+  void deallocate(void *ptr, size_t)
+  {
+    ++allocate_details::local_pool.counters.deallocations;
+    free(ptr);
+  }
+
+#endif
+
+  void release_pool()
+  {
+    using namespace allocate_details;
+    pool &p = local_pool;
+    for (size_t c = 0; c < nclasses; ++c) {
+      while (free_block *b = p.free_lists[c]) {
+        p.free_lists[c] = b->next;
+        free(b);
+      }
+      p.counters.releases += p.cached[c];
+      p.cached[c] = 0;
+    }
+  }
+
+  pool_scope::pool_scope()
+  {
+    ++allocate_details::local_pool.depth;
+  }
+
+  pool_scope::~pool_scope()
+  {
+    if (--allocate_details::local_pool.depth == 0)
+      release_pool();
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef PYTHONIC_UTILS_BITS_HPP
+#define PYTHONIC_UTILS_BITS_HPP
+
+#include "pythonic/include/utils/bits.hpp"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  int count_trailing_zeros(uint64_t word)
+  {
+#if defined(__GNUC__)
+    return __builtin_ctzll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return index;
+#else
+    int n = 0;
+    for (; !(word & 1); word >>= 1)
+      ++n;
+    return n;
+#endif
+  }
+
+  int count_leading_zeros(uint64_t word)
+  {
+#if defined(__GNUC__)
+    return __builtin_clzll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, word);
+    return 63 - index;
+#else
+    int n = 0;
+    for (; !(word >> 63); word <<= 1)
+      ++n;
+    return n;
+#endif
+  }
+
+  int popcount(uint64_t word)
+  {
+#if defined(__GNUC__)
+    return __builtin_popcountll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return (int)__popcnt64(word);
+#else
+    // bits summed by pairs, nibbles then bytes
+    word -= (word >> 1) & 0x5555555555555555ULL;
+    word = (word & 0x3333333333333333ULL) +
+           ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (int)((word * 0x0101010101010101ULL) >> 56);
+#endif
+  }
+
+  void prefetch(void const *address)
+  {
+#if defined(__GNUC__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+  }
+
+  void prefetch_for_write(void const *address)
+  {
+#if defined(__GNUC__)
+    __builtin_prefetch(address, 1);
+#else
+    (void)address;
+#endif
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -4,16 +4,8 @@
 #include "pythonic/include/utils/broadcast_copy.hpp"
 
 #include "pythonic/types/tuple.hpp"
-
-#ifdef _OPENMP
-#include <omp.h>
-
-// as a macro so that an enlightened user can modify this variable :-)
-#ifndef PYTHRAN_OPENMP_MIN_ITERATION_COUNT
-#define PYTHRAN_OPENMP_MIN_ITERATION_COUNT 1000
-#endif
-
-#endif
+#include "pythonic/utils/transpose_copy.hpp"
+#include "pythonic/utils/openmp.hpp"
 
 PYTHONIC_NS_BEGIN
 
@@ -195,6 +187,37 @@ namespace utils
     }
   };
 
+  /* a transposed ndarray is copied tile by tile into a target with
+   * contiguous rows, instead of being read with a large stride
+   */
+  template <class E, class T>
+  struct broadcast_copy_dispatcher<E, types::numpy_texpr<types::ndarray<T, 2>>,
+                                   2, 0, false> {
+    using F = types::numpy_texpr<types::ndarray<T, 2>>;
+    using target = transpose_buffer<typename std::decay<E>::type>;
+
+    void operator()(E &self, F const &other)
+    {
+      dispatch(self, other, std::integral_constant<bool, target::value>{});
+    }
+
+    void dispatch(E &self, F const &other, std::true_type)
+    {
+      if (self.shape() == other.shape())
+        transpose_copy(target::data(self), target::stride(self),
+                       other.arg.buffer, other.arg.shape()[1],
+                       other.shape()[0], other.shape()[1]);
+      else
+        dispatch(self, other, std::false_type{});
+    }
+
+    void dispatch(E &self, F const &other, std::false_type)
+    {
+      broadcast_copy_dispatcher<E, types::numpy_texpr_2<types::ndarray<T, 2>>,
+                                2, 0, false>{}(self, other);
+    }
+  };
+
   template <class E, class F, size_t N, size_t D, bool vector_form>
   E &broadcast_copy(E &self, F const &other)
   {
@@ -0,0 +1,715 @@
+#ifndef PYTHONIC_UTILS_FLAT_HASH_MAP_HPP
+#define PYTHONIC_UTILS_FLAT_HASH_MAP_HPP
+
+#include "pythonic/include/utils/flat_hash_map.hpp"
+
+#include "pythonic/utils/bits.hpp"
+#include "pythonic/types/str.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  namespace flat_hash_details
+  {
+    // Fibonacci hashing, folding the high bits of the product onto the low
+    // ones that select the group
+    size_t mix(uint64_t h)
+    {
+      h *= 0x9E3779B97F4A7C15ULL;
+      return h ^ (h >> 32);
+    }
+
+    group empty_group()
+    {
+      group g;
+      std::fill(std::begin(g.ctrl), std::end(g.ctrl), empty);
+      return g;
+    }
+
+    /* Each slot of a group is a byte of a word, whose high bit is set in
+     * the mask if the slot matches, as in the usual zero byte detection.
+     */
+    static const uint64_t lsbs = 0x0101010101010101ULL;
+    static const uint64_t msbs = 0x8080808080808080ULL;
+
+    uint64_t load_ctrl(group const &g)
+    {
+      uint64_t word;
+      std::memcpy(&word, g.ctrl, sizeof(word));
+      return word;
+    }
+
+    uint64_t match(group const &g, int8_t tag)
+    {
+      // a borrow may match a slot holding tag ^ 1 after a true match
+      uint64_t word = load_ctrl(g) ^ (lsbs * uint8_t(tag));
+      return (word - lsbs) & ~word & msbs;
+    }
+
+    uint64_t match_empty(group const &g)
+    {
+      // only empty slots have their high bit set and the next one unset
+      uint64_t word = load_ctrl(g);
+      return word & ~(word << 6) & msbs;
+    }
+
+    uint64_t match_free(group const &g)
+    {
+      return load_ctrl(g) & msbs;
+    }
+
+    size_t first_slot(uint64_t mask)
+    {
+      return count_trailing_zeros(mask) >> 3;
+    }
+
+    int8_t tag(size_t h)
+    {
+      return h >> (8 * sizeof(size_t) - 7);
+    }
+
+    // keep the load factor below 7/8
+    size_t groups_for(size_t n)
+    {
+      size_t ngroups = 2;
+      while (ngroups * group_size - ngroups * group_size / 8 < n)
+        ngroups *= 2;
+      return ngroups;
+    }
+
+    /* Groups are probed following triangular numbers, which visit each of
+     * them once, their number being a power of two. There is always a free
+     * slot, so the probe stops on the first group that contains one.
+     */
+    template <class F>
+    inline size_t find_slot(std::vector<group> const &groups, size_t h,
+                            F const &is_match)
+    {
+      size_t const ngroups = groups.size();
+      if (ngroups == 0)
+        return 0;
+      int8_t const t = tag(h);
+      for (size_t g = h & (ngroups - 1), step = 1;;
+           g = (g + step++) & (ngroups - 1)) {
+        group const &curr = groups[g];
+        for (uint64_t mask = match(curr, t); mask; mask &= mask - 1) {
+          size_t i = first_slot(mask);
+          if (is_match(curr.index[i]))
+            return g * group_size + i;
+        }
+        if (match_empty(curr))
+          return ngroups * group_size;
+      }
+    }
+
+    size_t free_slot(std::vector<group> const &groups, size_t h)
+    {
+      size_t const ngroups = groups.size();
+      for (size_t g = h & (ngroups - 1), step = 1;;
+           g = (g + step++) & (ngroups - 1))
+        if (uint64_t mask = match_free(groups[g]))
+          return g * group_size + first_slot(mask);
+    }
+
+    template <class T>
+    T &entry<T>::item()
+    {
+      return *reinterpret_cast<T *>(&raw);
+    }
+
+    template <class T>
+    T const &entry<T>::item() const
+    {
+      return *reinterpret_cast<T const *>(&raw);
+    }
+
+    template <class E>
+    storage<E>::storage()
+        : count(0)
+    {
+    }
+
+    template <class E>
+    storage<E>::storage(storage &&other)
+        : chunks(std::move(other.chunks)), count(other.count)
+    {
+      other.chunks.clear();
+      other.count = 0;
+    }
+
+    template <class E>
+    storage<E> &storage<E>::operator=(storage &&other)
+    {
+      if (this != &other) {
+        chunks = std::move(other.chunks);
+        count = other.count;
+        other.chunks.clear();
+        other.count = 0;
+      }
+      return *this;
+    }
+
+    template <class E>
+    size_t storage<E>::size() const
+    {
+      return count;
+    }
+
+    template <class E>
+    size_t storage<E>::chunk_of(size_t i)
+    {
+      size_t high = i >> first_chunk_bits;
+      return high ? 64 - count_leading_zeros(high) : 0;
+    }
+
+    template <class E>
+    size_t storage<E>::offset_of(size_t i, size_t chunk)
+    {
+      return chunk ? i - (size_t(1) << (first_chunk_bits + chunk - 1)) : i;
+    }
+
+    template <class E>
+    E &storage<E>::operator[](size_t i)
+    {
+      size_t chunk = chunk_of(i);
+      return chunks[chunk][offset_of(i, chunk)];
+    }
+
+    template <class E>
+    E const &storage<E>::operator[](size_t i) const
+    {
+      size_t chunk = chunk_of(i);
+      return chunks[chunk][offset_of(i, chunk)];
+    }
+
+    template <class E>
+    E &storage<E>::back()
+    {
+      return (*this)[count - 1];
+    }
+
+    template <class E>
+    E &storage<E>::next()
+    {
+      if (chunk_of(count) == chunks.size()) {
+        size_t chunk_size = chunks.empty() ? size_t(1) << first_chunk_bits
+                                           : count;
+        chunks.emplace_back(new E[chunk_size]);
+      }
+      return (*this)[count];
+    }
+
+    template <class E>
+    void storage<E>::push_back()
+    {
+      ++count;
+    }
+
+    template <class E>
+    void storage<E>::pop_back()
+    {
+      --count;
+    }
+
+    template <class E>
+    void storage<E>::clear()
+    {
+      chunks.clear();
+      count = 0;
+    }
+  }
+
+  template <class K>
+  size_t flat_hash<K>::operator()(K const &key) const
+  {
+    return flat_hash_details::mix(std::hash<K>()(key));
+  }
+
+  size_t flat_hash<long>::operator()(long key) const
+  {
+    return flat_hash_details::mix(key);
+  }
+
+  size_t flat_hash<double>::operator()(double key) const
+  {
+    // 0. and -0. are equal, so they must share the same hash
+    if (key == 0.)
+      key = 0.;
+    uint64_t bits;
+    std::memcpy(&bits, &key, sizeof(key));
+    return flat_hash_details::mix(bits);
+  }
+
+  template <class T>
+  size_t flat_hash<std::complex<T>>::
+  operator()(std::complex<T> const &key) const
+  {
+    // mixed again so that the hashes of both parts do not cancel out
+    size_t h = flat_hash<T>()(key.real());
+    return flat_hash_details::mix(h) ^ flat_hash<T>()(key.imag());
+  }
+
+  size_t flat_hash<types::str>::operator()(types::str const &key) const
+  {
+    return std::hash<types::str>()(key);
+  }
+
+  /// flat_hash_iterator implementation
+  template <class T, class S>
+  flat_hash_iterator<T, S>::flat_hash_iterator(S *entries, size_t index)
+      : entries(entries), index(index)
+  {
+  }
+
+  template <class T, class S>
+  template <class OT, class OS>
+  flat_hash_iterator<T, S>::flat_hash_iterator(
+      flat_hash_iterator<OT, OS> const &other)
+      : entries(other.entries), index(other.index)
+  {
+  }
+
+  template <class T, class S>
+  flat_hash_iterator<T, S> &flat_hash_iterator<T, S>::skip()
+  {
+    while (index != entries->size() &&
+           (*entries)[index].hash == flat_hash_details::dead)
+      ++index;
+    return *this;
+  }
+
+  template <class T, class S>
+  T &flat_hash_iterator<T, S>::operator*() const
+  {
+    return (*entries)[index].item();
+  }
+
+  template <class T, class S>
+  T *flat_hash_iterator<T, S>::operator->() const
+  {
+    return &(*entries)[index].item();
+  }
+
+  template <class T, class S>
+  flat_hash_iterator<T, S> &flat_hash_iterator<T, S>::operator++()
+  {
+    ++index;
+    return skip();
+  }
+
+  template <class T, class S>
+  flat_hash_iterator<T, S> flat_hash_iterator<T, S>::operator++(int)
+  {
+    flat_hash_iterator<T, S> self = *this;
+    ++*this;
+    return self;
+  }
+
+  template <class T, class S>
+  bool flat_hash_iterator<T, S>::
+  operator==(flat_hash_iterator<T, S> const &other) const
+  {
+    return index == other.index;
+  }
+
+  template <class T, class S>
+  bool flat_hash_iterator<T, S>::
+  operator!=(flat_hash_iterator<T, S> const &other) const
+  {
+    return index != other.index;
+  }
+
+  namespace flat_hash_details
+  {
+    template <class T>
+    T const &identity_key::operator()(T const &item) const
+    {
+      return item;
+    }
+
+    template <class P>
+    typename P::first_type const &first_key::operator()(P const &item) const
+    {
+      return item.first;
+    }
+  }
+
+  /// flat_hash_table implementation
+  template <class K, class T, class KeyOf, class Hash>
+  flat_hash_table<K, T, KeyOf, Hash>::flat_hash_table()
+      : live(0), used(0), head(0)
+  {
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  flat_hash_table<K, T, KeyOf, Hash>::flat_hash_table(size_type capacity)
+      : flat_hash_table()
+  {
+    reserve(capacity);
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  flat_hash_table<K, T, KeyOf, Hash>::flat_hash_table(
+      flat_hash_table const &other)
+      : flat_hash_table()
+  {
+    *this = other;
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  flat_hash_table<K, T, KeyOf, Hash>::flat_hash_table(flat_hash_table &&other)
+      : entries(std::move(other.entries)), groups(std::move(other.groups)),
+        live(other.live), used(other.used), head(other.head)
+  {
+    other.groups.clear();
+    other.live = other.used = other.head = 0;
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  flat_hash_table<K, T, KeyOf, Hash> &flat_hash_table<K, T, KeyOf, Hash>::
+  operator=(flat_hash_table const &other)
+  {
+    if (this == &other)
+      return *this;
+    destroy();
+    entries.clear();
+    groups.clear();
+    live = used = head = 0;
+    // erased entries are copied as such, so that the index stays valid
+    try {
+      for (size_type index = 0; index < other.entries.size(); ++index) {
+        entry_type const &from = other.entries[index];
+        entry_type &to = entries.next();
+        if (from.hash != flat_hash_details::dead)
+          new (&to.raw) T(from.item());
+        to.hash = from.hash;
+        entries.push_back();
+      }
+    } catch (...) {
+      destroy();
+      entries.clear();
+      throw;
+    }
+    groups = other.groups;
+    live = other.live;
+    used = other.used;
+    head = other.head;
+    return *this;
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  flat_hash_table<K, T, KeyOf, Hash> &flat_hash_table<K, T, KeyOf, Hash>::
+  operator=(flat_hash_table &&other)
+  {
+    if (this != &other) {
+      destroy();
+      entries = std::move(other.entries);
+      groups = std::move(other.groups);
+      live = other.live;
+      used = other.used;
+      head = other.head;
+      other.groups.clear();
+      other.live = other.used = other.head = 0;
+    }
+    return *this;
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  flat_hash_table<K, T, KeyOf, Hash>::~flat_hash_table()
+  {
+    destroy();
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  void flat_hash_table<K, T, KeyOf, Hash>::destroy()
+  {
+    for (size_type index = 0; index < entries.size(); ++index)
+      if (entries[index].hash != flat_hash_details::dead)
+        entries[index].item().~T();
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  typename flat_hash_table<K, T, KeyOf, Hash>::iterator
+  flat_hash_table<K, T, KeyOf, Hash>::begin()
+  {
+    return iterator(&entries, head).skip();
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  typename flat_hash_table<K, T, KeyOf, Hash>::const_iterator
+  flat_hash_table<K, T, KeyOf, Hash>::begin() const
+  {
+    return const_iterator(&entries, head).skip();
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  typename flat_hash_table<K, T, KeyOf, Hash>::iterator
+  flat_hash_table<K, T, KeyOf, Hash>::end()
+  {
+    return {&entries, entries.size()};
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  typename flat_hash_table<K, T, KeyOf, Hash>::const_iterator
+  flat_hash_table<K, T, KeyOf, Hash>::end() const
+  {
+    return {&entries, entries.size()};
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  typename flat_hash_table<K, T, KeyOf, Hash>::iterator
+  flat_hash_table<K, T, KeyOf, Hash>::back()
+  {
+    // the storage never ends with an erased entry
+    if (entries.size() == 0)
+      return end();
+    return {&entries, entries.size() - 1};
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  typename flat_hash_table<K, T, KeyOf, Hash>::size_type
+  flat_hash_table<K, T, KeyOf, Hash>::size() const
+  {
+    return live;
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  bool flat_hash_table<K, T, KeyOf, Hash>::empty() const
+  {
+    return live == 0;
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  size_t flat_hash_table<K, T, KeyOf, Hash>::hash(K const &key) const
+  {
+    size_t h = Hash()(key);
+    return h == flat_hash_details::dead ? h - 1 : h;
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  typename flat_hash_table<K, T, KeyOf, Hash>::size_type
+  flat_hash_table<K, T, KeyOf, Hash>::capacity() const
+  {
+    return groups.size() * flat_hash_details::group_size;
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  int8_t &flat_hash_table<K, T, KeyOf, Hash>::ctrl_of(size_type slot)
+  {
+    return groups[slot / flat_hash_details::group_size]
+        .ctrl[slot % flat_hash_details::group_size];
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  uint32_t &flat_hash_table<K, T, KeyOf, Hash>::index_of(size_type slot)
+  {
+    return groups[slot / flat_hash_details::group_size]
+        .index[slot % flat_hash_details::group_size];
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  uint32_t flat_hash_table<K, T, KeyOf, Hash>::index_of(size_type slot) const
+  {
+    return groups[slot / flat_hash_details::group_size]
+        .index[slot % flat_hash_details::group_size];
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  typename flat_hash_table<K, T, KeyOf, Hash>::size_type
+  flat_hash_table<K, T, KeyOf, Hash>::find_slot(K const &key, size_t h) const
+  {
+    return flat_hash_details::find_slot(groups, h, [&](size_type index) {
+      entry_type const &e = entries[index];
+      return e.hash == h && KeyOf()(e.item()) == key;
+    });
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  typename flat_hash_table<K, T, KeyOf, Hash>::iterator
+  flat_hash_table<K, T, KeyOf, Hash>::find(K const &key)
+  {
+    size_type slot = find_slot(key, hash(key));
+    if (slot == capacity())
+      return end();
+    return {&entries, index_of(slot)};
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  typename flat_hash_table<K, T, KeyOf, Hash>::const_iterator
+  flat_hash_table<K, T, KeyOf, Hash>::find(K const &key) const
+  {
+    size_type slot = find_slot(key, hash(key));
+    if (slot == capacity())
+      return end();
+    return {&entries, index_of(slot)};
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  bool flat_hash_table<K, T, KeyOf, Hash>::contains(K const &key) const
+  {
+    return find_slot(key, hash(key)) != capacity();
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  void flat_hash_table<K, T, KeyOf, Hash>::insert_slot(size_type index,
+                                                       size_t h)
+  {
+    size_type slot = flat_hash_details::free_slot(groups, h);
+    int8_t &ctrl = ctrl_of(slot);
+    used += ctrl == flat_hash_details::empty;
+    ctrl = flat_hash_details::tag(h);
+    index_of(slot) = index;
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  template <class F>
+  T &flat_hash_table<K, T, KeyOf, Hash>::find_or_insert(K const &key,
+                                                         F const &make)
+  {
+    size_t h = hash(key);
+    size_type slot = find_slot(key, h);
+    if (slot != capacity())
+      return entries[index_of(slot)].item();
+
+    if (used + 1 > capacity() - capacity() / 8) {
+      if (entries.size() > 2 * live)
+        compact();
+      // erased slots may be reclaimed without growing
+      rehash(flat_hash_details::groups_for(2 * (live + 1)));
+    }
+    entry_type &e = entries.next();
+    new (&e.raw) T(make());
+    e.hash = h;
+    entries.push_back();
+    insert_slot(entries.size() - 1, h);
+    ++live;
+    return e.item();
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  typename flat_hash_table<K, T, KeyOf, Hash>::iterator
+  flat_hash_table<K, T, KeyOf, Hash>::erase(iterator where)
+  {
+    size_type index = where.index;
+    size_type slot = flat_hash_details::find_slot(
+        groups, entries[index].hash,
+        [index](size_type other) { return other == index; });
+    ctrl_of(slot) = flat_hash_details::deleted;
+    --live;
+    entry_type &e = entries[index];
+    e.item().~T();
+    e.hash = flat_hash_details::dead;
+    if (index + 1 == entries.size()) {
+      do
+        entries.pop_back();
+      while (entries.size() != 0 &&
+             entries.back().hash == flat_hash_details::dead);
+      head = std::min(head, entries.size());
+      return end();
+    }
+    iterator next = iterator(&entries, index + 1).skip();
+    if (index == head)
+      head = next.index;
+    return next;
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  typename flat_hash_table<K, T, KeyOf, Hash>::size_type
+  flat_hash_table<K, T, KeyOf, Hash>::erase(K const &key)
+  {
+    size_type slot = find_slot(key, hash(key));
+    if (slot == capacity())
+      return 0;
+    erase(iterator(&entries, index_of(slot)));
+    return 1;
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  void flat_hash_table<K, T, KeyOf, Hash>::clear()
+  {
+    destroy();
+    entries.clear();
+    std::fill(groups.begin(), groups.end(), flat_hash_details::empty_group());
+    live = used = head = 0;
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  void flat_hash_table<K, T, KeyOf, Hash>::reserve(size_type n)
+  {
+    size_type ngroups = flat_hash_details::groups_for(n);
+    if (ngroups > groups.size())
+      rehash(ngroups);
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  void flat_hash_table<K, T, KeyOf, Hash>::rehash(size_type ngroups)
+  {
+    groups.assign(ngroups, flat_hash_details::empty_group());
+    used = 0;
+    for (size_type index = 0; index < entries.size(); ++index)
+      if (entries[index].hash != flat_hash_details::dead)
+        insert_slot(index, entries[index].hash);
+  }
+
+  template <class K, class T, class KeyOf, class Hash>
+  void flat_hash_table<K, T, KeyOf, Hash>::compact()
+  {
+    size_type last = 0;
+    for (size_type index = 0; index < entries.size(); ++index) {
+      entry_type &from = entries[index];
+      if (from.hash == flat_hash_details::dead)
+        continue;
+      if (last != index) {
+        entry_type &to = entries[last];
+        new (&to.raw) T(std::move(from.item()));
+        from.item().~T();
+        to.hash = from.hash;
+        from.hash = flat_hash_details::dead;
+      }
+      ++last;
+    }
+    while (entries.size() != last)
+      entries.pop_back();
+    head = 0;
+  }
+
+  /// flat_hash_map implementation
+  template <class K, class V, class Hash>
+  flat_hash_map<K, V, Hash>::flat_hash_map()
+      : table_type()
+  {
+  }
+
+  template <class K, class V, class Hash>
+  flat_hash_map<K, V, Hash>::flat_hash_map(size_type capacity)
+      : table_type(capacity)
+  {
+  }
+
+  template <class K, class V, class Hash>
+  template <class B, class E>
+  flat_hash_map<K, V, Hash>::flat_hash_map(B begin, E end)
+      : table_type()
+  {
+    for (; begin != end; ++begin) {
+      auto const &kv = *begin;
+      (*this)[std::get<0>(kv)] = std::get<1>(kv);
+    }
+  }
+
+  template <class K, class V, class Hash>
+  V &flat_hash_map<K, V, Hash>::operator[](K const &key)
+  {
+    return this->find_or_insert(key, [&key]() { return value_type{key, V()}; })
+        .second;
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,544 @@
+#ifndef PYTHONIC_UTILS_FLAT_HASH_SET_HPP
+#define PYTHONIC_UTILS_FLAT_HASH_SET_HPP
+
+#include "pythonic/include/utils/flat_hash_set.hpp"
+
+#include "pythonic/utils/flat_hash_map.hpp"
+#include "pythonic/utils/bits.hpp"
+
+#include <algorithm>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  namespace flat_hash_details
+  {
+    template <class T, bool B>
+    uint64_t dense_key<T, B>::to_key(T const &)
+    {
+      return 0;
+    }
+
+    template <class T, bool B>
+    T dense_key<T, B>::from_key(uint64_t)
+    {
+      return T();
+    }
+
+    // flipping the sign bit orders the negative integers first
+    template <class T>
+    uint64_t dense_key<T, true>::to_key(T item)
+    {
+      return std::is_signed<T>::value ? uint64_t(int64_t(item)) ^ (1ULL << 63)
+                                      : uint64_t(item);
+    }
+
+    template <class T>
+    T dense_key<T, true>::from_key(uint64_t key)
+    {
+      return std::is_signed<T>::value ? T(int64_t(key ^ (1ULL << 63)))
+                                      : T(key);
+    }
+
+    /// dense_bits implementation
+
+    // below that many words, the bitset is small anyway
+    static const uint64_t min_dense_words = 64;
+
+    dense_bits::dense_bits()
+        : first(0), count(0), head(0)
+    {
+    }
+
+    bool dense_bits::fits(uint64_t nwords, size_t n)
+    {
+      return nwords <= std::max<uint64_t>(n, min_dense_words);
+    }
+
+    void dense_bits::widen(uint64_t lo, uint64_t hi)
+    {
+      if (lo < first) {
+        size_t shift = first - lo;
+        words.insert(words.begin(), shift, 0);
+        first = lo;
+        head += shift;
+      }
+      if (hi - first >= words.size())
+        words.resize(hi - first + 1, 0);
+    }
+
+    void dense_bits::recount()
+    {
+      count = 0;
+      for (uint64_t word : words)
+        count += popcount(word);
+    }
+
+    size_t dense_bits::size() const
+    {
+      return count;
+    }
+
+    bool dense_bits::contains(uint64_t key) const
+    {
+      uint64_t w = key / 64 - first;
+      // keys before the range wrap around past its end
+      return w < words.size() && (words[w] >> (key % 64)) & 1;
+    }
+
+    bool dense_bits::insert(uint64_t key)
+    {
+      uint64_t w = key / 64;
+      if (words.empty()) {
+        words.assign(1, 0);
+        first = w;
+        head = 0;
+      } else if (w < first) {
+        uint64_t nwords = first + words.size() - w;
+        if (!fits(nwords, count + 1))
+          return false;
+        // leave some room below, so that descending insertions do not move
+        // the whole bitset each time
+        uint64_t room = std::max<uint64_t>(count + 1, min_dense_words) - nwords;
+        widen(w - std::min(std::min<uint64_t>(room, words.size()), w), w);
+      } else if (w - first >= words.size()) {
+        if (!fits(w - first + 1, count + 1))
+          return false;
+        widen(first, w);
+      }
+      uint64_t &word = words[w - first];
+      uint64_t bit = 1ULL << (key % 64);
+      count += !(word & bit);
+      word |= bit;
+      head = std::min<size_t>(head, w - first);
+      return true;
+    }
+
+    bool dense_bits::erase(uint64_t key)
+    {
+      if (!contains(key))
+        return false;
+      words[key / 64 - first] &= ~(1ULL << (key % 64));
+      --count;
+      return true;
+    }
+
+    uint64_t dense_bits::pop()
+    {
+      while (!words[head])
+        ++head;
+      uint64_t &word = words[head];
+      uint64_t bit = count_trailing_zeros(word);
+      word &= word - 1;
+      --count;
+      return (first + head) * 64 + bit;
+    }
+
+    void dense_bits::clear()
+    {
+      words.clear();
+      first = count = head = 0;
+    }
+
+    size_t dense_bits::begin_pos() const
+    {
+      return count ? next_pos(head * 64 - 1) : end_pos();
+    }
+
+    size_t dense_bits::end_pos() const
+    {
+      return words.size() * 64;
+    }
+
+    size_t dense_bits::next_pos(size_t pos) const
+    {
+      ++pos;
+      size_t w = pos / 64;
+      if (w == words.size())
+        return end_pos();
+      // drop the bits before ``pos''
+      uint64_t word = words[w] & (~0ULL << (pos % 64));
+      while (!word) {
+        if (++w == words.size())
+          return end_pos();
+        word = words[w];
+      }
+      return w * 64 + count_trailing_zeros(word);
+    }
+
+    uint64_t dense_bits::key_at(size_t pos) const
+    {
+      return first * 64 + pos;
+    }
+
+    bool dense_bits::merge(dense_bits const &other)
+    {
+      if (other.count == 0)
+        return true;
+      if (count == 0) {
+        *this = other;
+        return true;
+      }
+      uint64_t lo = std::min(first, other.first);
+      uint64_t hi = std::max(first + words.size(),
+                             other.first + other.words.size()) -
+                    1;
+      if (!fits(hi - lo + 1, count + other.count))
+        return false;
+      widen(lo, hi);
+      uint64_t *out = words.data() + (other.first - first);
+      uint64_t const *in = other.words.data();
+      for (size_t i = 0, n = other.words.size(); i < n; ++i)
+        out[i] |= in[i];
+      head = std::min<size_t>(head, other.first - first + other.head);
+      recount();
+      return true;
+    }
+
+    void dense_bits::intersect(dense_bits const &other)
+    {
+      uint64_t lo = std::max(first, other.first);
+      uint64_t hi = std::min(first + words.size(),
+                             other.first + other.words.size());
+      if (lo >= hi) {
+        clear();
+        return;
+      }
+      // bits out of the common range are cleared
+      std::fill(words.begin(), words.begin() + (lo - first), 0);
+      std::fill(words.begin() + (hi - first), words.end(), 0);
+      uint64_t *out = words.data() + (lo - first);
+      uint64_t const *in = other.words.data() + (lo - other.first);
+      for (size_t i = 0, n = hi - lo; i < n; ++i)
+        out[i] &= in[i];
+      recount();
+    }
+
+    void dense_bits::subtract(dense_bits const &other)
+    {
+      uint64_t lo = std::max(first, other.first);
+      uint64_t hi = std::min(first + words.size(),
+                             other.first + other.words.size());
+      if (lo >= hi)
+        return;
+      uint64_t *out = words.data() + (lo - first);
+      uint64_t const *in = other.words.data() + (lo - other.first);
+      for (size_t i = 0, n = hi - lo; i < n; ++i)
+        out[i] &= ~in[i];
+      recount();
+    }
+
+    bool dense_bits::is_subset_of(dense_bits const &other) const
+    {
+      uint64_t end = first + words.size();
+      uint64_t lo = std::min(std::max(first, other.first), end);
+      uint64_t hi =
+          std::max(lo, std::min(end, other.first + other.words.size()));
+      // bits out of the range of ``other'' must all be cleared
+      uint64_t outside = 0;
+      for (size_t i = 0, n = lo - first; i < n; ++i)
+        outside |= words[i];
+      for (size_t i = hi - first, n = words.size(); i < n; ++i)
+        outside |= words[i];
+      if (outside || lo == hi)
+        return !outside;
+      uint64_t const *self = words.data() + (lo - first);
+      uint64_t const *in = other.words.data() + (lo - other.first);
+      uint64_t extra = 0;
+      for (size_t i = 0, n = hi - lo; i < n; ++i)
+        extra |= self[i] & ~in[i];
+      return !extra;
+    }
+
+    bool dense_bits::is_disjoint_from(dense_bits const &other) const
+    {
+      uint64_t lo = std::max(first, other.first);
+      uint64_t hi = std::min(first + words.size(),
+                             other.first + other.words.size());
+      uint64_t common = 0;
+      for (uint64_t w = lo; w < hi; ++w)
+        common |= words[w - first] & other.words[w - other.first];
+      return !common;
+    }
+  }
+
+  /// flat_hash_set_iterator implementation
+  template <class T, class Hash>
+  flat_hash_set_iterator<T, Hash>::flat_hash_set_iterator(
+      flat_hash_details::dense_bits const *bits, size_t pos)
+      : bits(bits), pos(pos), value(), item()
+  {
+    load();
+  }
+
+  template <class T, class Hash>
+  flat_hash_set_iterator<T, Hash>::flat_hash_set_iterator(item_iterator item)
+      : bits(nullptr), pos(0), value(), item(item)
+  {
+  }
+
+  template <class T, class Hash>
+  void flat_hash_set_iterator<T, Hash>::load()
+  {
+    if (pos != bits->end_pos())
+      value = flat_hash_details::dense_key<T>::from_key(bits->key_at(pos));
+  }
+
+  template <class T, class Hash>
+  T const &flat_hash_set_iterator<T, Hash>::operator*() const
+  {
+    return bits ? value : *item;
+  }
+
+  template <class T, class Hash>
+  T const *flat_hash_set_iterator<T, Hash>::operator->() const
+  {
+    return &**this;
+  }
+
+  template <class T, class Hash>
+  flat_hash_set_iterator<T, Hash> &flat_hash_set_iterator<T, Hash>::
+  operator++()
+  {
+    if (bits) {
+      pos = bits->next_pos(pos);
+      load();
+    } else
+      ++item;
+    return *this;
+  }
+
+  template <class T, class Hash>
+  flat_hash_set_iterator<T, Hash> flat_hash_set_iterator<T, Hash>::
+  operator++(int)
+  {
+    flat_hash_set_iterator<T, Hash> self = *this;
+    ++*this;
+    return self;
+  }
+
+  template <class T, class Hash>
+  bool flat_hash_set_iterator<T, Hash>::
+  operator==(flat_hash_set_iterator<T, Hash> const &other) const
+  {
+    return pos == other.pos && item == other.item;
+  }
+
+  template <class T, class Hash>
+  bool flat_hash_set_iterator<T, Hash>::
+  operator!=(flat_hash_set_iterator<T, Hash> const &other) const
+  {
+    return !(*this == other);
+  }
+
+  /// flat_hash_set implementation
+  template <class T, class Hash>
+  flat_hash_set<T, Hash>::flat_hash_set()
+      : dense(key_traits::value)
+  {
+  }
+
+  template <class T, class Hash>
+  template <class B, class E>
+  flat_hash_set<T, Hash>::flat_hash_set(B begin, E end)
+      : flat_hash_set()
+  {
+    insert(begin, end);
+  }
+
+  template <class T, class Hash>
+  bool flat_hash_set<T, Hash>::is_dense() const
+  {
+    // known at compile time for types that cannot be dense
+    return key_traits::value && dense;
+  }
+
+  template <class T, class Hash>
+  typename flat_hash_set<T, Hash>::iterator
+  flat_hash_set<T, Hash>::begin() const
+  {
+    if (is_dense())
+      return {&bits, bits.begin_pos()};
+    return table.begin();
+  }
+
+  template <class T, class Hash>
+  typename flat_hash_set<T, Hash>::iterator flat_hash_set<T, Hash>::end() const
+  {
+    if (is_dense())
+      return {&bits, bits.end_pos()};
+    return table.end();
+  }
+
+  template <class T, class Hash>
+  typename flat_hash_set<T, Hash>::size_type
+  flat_hash_set<T, Hash>::size() const
+  {
+    return is_dense() ? bits.size() : table.size();
+  }
+
+  template <class T, class Hash>
+  bool flat_hash_set<T, Hash>::empty() const
+  {
+    return size() == 0;
+  }
+
+  template <class T, class Hash>
+  bool flat_hash_set<T, Hash>::contains(T const &item) const
+  {
+    if (is_dense())
+      return bits.contains(key_traits::to_key(item));
+    return table.contains(item);
+  }
+
+  template <class T, class Hash>
+  void flat_hash_set<T, Hash>::insert(T const &item)
+  {
+    if (is_dense()) {
+      if (bits.insert(key_traits::to_key(item)))
+        return;
+      make_sparse();
+    }
+    table.find_or_insert(item, [&item]() { return item; });
+  }
+
+  template <class T, class Hash>
+  template <class B, class E>
+  void flat_hash_set<T, Hash>::insert(B begin, E end)
+  {
+    for (; begin != end; ++begin)
+      insert(*begin);
+  }
+
+  template <class T, class Hash>
+  typename flat_hash_set<T, Hash>::size_type
+  flat_hash_set<T, Hash>::erase(T const &item)
+  {
+    if (is_dense())
+      return bits.erase(key_traits::to_key(item));
+    return table.erase(item);
+  }
+
+  template <class T, class Hash>
+  T flat_hash_set<T, Hash>::pop()
+  {
+    if (is_dense())
+      return key_traits::from_key(bits.pop());
+    auto first = table.begin();
+    T item = *first;
+    table.erase(first);
+    return item;
+  }
+
+  template <class T, class Hash>
+  void flat_hash_set<T, Hash>::clear()
+  {
+    table.clear();
+    bits.clear();
+    dense = key_traits::value;
+  }
+
+  template <class T, class Hash>
+  void flat_hash_set<T, Hash>::reserve(size_type n)
+  {
+    if (!is_dense())
+      table.reserve(n);
+  }
+
+  template <class T, class Hash>
+  void flat_hash_set<T, Hash>::make_sparse()
+  {
+    table.reserve(bits.size() + 1);
+    for (auto pos = bits.begin_pos(), end = bits.end_pos(); pos != end;
+         pos = bits.next_pos(pos)) {
+      T item = key_traits::from_key(bits.key_at(pos));
+      table.find_or_insert(item, [&item]() { return item; });
+    }
+    bits.clear();
+    dense = false;
+  }
+
+  template <class T, class Hash>
+  void flat_hash_set<T, Hash>::merge(flat_hash_set const &other)
+  {
+    if (is_dense() && other.is_dense()) {
+      if (bits.merge(other.bits))
+        return;
+      make_sparse();
+    }
+    reserve(size() + other.size());
+    insert(other.begin(), other.end());
+  }
+
+  template <class T, class Hash>
+  void flat_hash_set<T, Hash>::intersect(flat_hash_set const &other)
+  {
+    if (is_dense() && other.is_dense())
+      return bits.intersect(other.bits);
+    flat_hash_set const &small = size() <= other.size() ? *this : other;
+    flat_hash_set const &large = size() <= other.size() ? other : *this;
+    flat_hash_set common;
+    for (T const &item : small)
+      if (large.contains(item))
+        common.insert(item);
+    *this = std::move(common);
+  }
+
+  template <class T, class Hash>
+  void flat_hash_set<T, Hash>::subtract(flat_hash_set const &other)
+  {
+    // items of ``other'' cannot be erased while iterating over it
+    if (&other == this)
+      return clear();
+    if (is_dense() && other.is_dense())
+      return bits.subtract(other.bits);
+    if (other.size() <= size()) {
+      for (T const &item : other)
+        erase(item);
+      return;
+    }
+    flat_hash_set rest;
+    for (T const &item : *this)
+      if (!other.contains(item))
+        rest.insert(item);
+    *this = std::move(rest);
+  }
+
+  template <class T, class Hash>
+  bool flat_hash_set<T, Hash>::is_subset_of(flat_hash_set const &other) const
+  {
+    if (size() > other.size())
+      return false;
+    if (is_dense() && other.is_dense())
+      return bits.is_subset_of(other.bits);
+    for (T const &item : *this)
+      if (!other.contains(item))
+        return false;
+    return true;
+  }
+
+  template <class T, class Hash>
+  bool flat_hash_set<T, Hash>::is_disjoint_from(
+      flat_hash_set const &other) const
+  {
+    if (is_dense() && other.is_dense())
+      return bits.is_disjoint_from(other.bits);
+    flat_hash_set const &small = size() <= other.size() ? *this : other;
+    flat_hash_set const &large = size() <= other.size() ? other : *this;
+    for (T const &item : small)
+      if (large.contains(item))
+        return false;
+    return true;
+  }
+
+  template <class T, class Hash>
+  bool flat_hash_set<T, Hash>::operator==(flat_hash_set const &other) const
+  {
+    return size() == other.size() && is_subset_of(other);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
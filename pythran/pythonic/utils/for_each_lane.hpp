@@ -0,0 +1,95 @@
+#ifndef PYTHONIC_UTILS_FOR_EACH_LANE_HPP
+#define PYTHONIC_UTILS_FOR_EACH_LANE_HPP
+
+#include "pythonic/include/utils/for_each_lane.hpp"
+
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/utils/transpose_copy.hpp"
+#include "pythonic/utils/openmp.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  template <class T, size_t N, class F>
+  void for_each_lane(types::ndarray<T, N> &self, long axis, F const &f)
+  {
+    auto &&shape = self.shape();
+    long const flat_size = self.flat_size();
+    long const lane_size = shape[axis];
+    if (flat_size == 0)
+      return;
+    // distance between two consecutive elements of a lane
+    long const stride = std::accumulate(shape.begin() + axis + 1, shape.end(),
+                                        1L, std::multiplies<long>());
+
+    if (stride == 1 || lane_size == 1) {
+      long const nlanes = flat_size / lane_size;
+      auto do_lane = [&self, lane_size](F &g, long i) {
+        g(self.buffer + i * lane_size, self.buffer + (i + 1) * lane_size, i);
+      };
+#ifdef _OPENMP
+      if (flat_size >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT && nlanes > 1)
+#pragma omp parallel
+      {
+        F g = f;
+#pragma omp for
+        for (long i = 0; i < nlanes; ++i)
+          do_lane(g, i);
+      }
+      else
+#endif
+      {
+        F g = f;
+        for (long i = 0; i < nlanes; ++i)
+          do_lane(g, i);
+      }
+    } else {
+      // each outer slice is a lane_size x stride matrix whose columns are
+      // the lanes
+      static const long block = PYTHRAN_TRANSPOSE_TILE_SIZE;
+      long const nouter = flat_size / (lane_size * stride);
+      long const nblocks = (stride + block - 1) / block;
+      long const ntasks = nouter * nblocks;
+      auto do_block = [&self, lane_size, stride, nblocks](F &g, T *lanes,
+                                                          long task) {
+        long const outer = task / nblocks;
+        long const j = (task % nblocks) * block;
+        long const width = std::min(block, stride - j);
+        T *base = self.buffer + outer * lane_size * stride + j;
+        transpose_copy(lanes, lane_size, base, stride, width, lane_size);
+        for (long k = 0; k < width; ++k)
+          g(lanes + k * lane_size, lanes + (k + 1) * lane_size,
+            outer * stride + j + k);
+        transpose_copy(base, stride, lanes, lane_size, lane_size, width);
+      };
+#ifdef _OPENMP
+      if (flat_size >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT && ntasks > 1)
+#pragma omp parallel
+      {
+        F g = f;
+        std::unique_ptr<T[]> lanes{new T[block * lane_size]};
+#pragma omp for
+        for (long task = 0; task < ntasks; ++task)
+          do_block(g, lanes.get(), task);
+      }
+      else
+#endif
+      {
+        F g = f;
+        std::unique_ptr<T[]> lanes{new T[block * lane_size]};
+        for (long task = 0; task < ntasks; ++task)
+          do_block(g, lanes.get(), task);
+      }
+    }
+  }
+}
+PYTHONIC_NS_END
+
+#endif
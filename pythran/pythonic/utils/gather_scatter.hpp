@@ -0,0 +1,217 @@
+#ifndef PYTHONIC_UTILS_GATHER_SCATTER_HPP
+#define PYTHONIC_UTILS_GATHER_SCATTER_HPP
+
+#include "pythonic/include/utils/gather_scatter.hpp"
+
+#include "pythonic/utils/bits.hpp"
+#include "pythonic/types/vectorizable_type.hpp"
+#include "pythonic/utils/openmp.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+#ifdef USE_BOOST_SIMD
+#include <boost/simd/pack.hpp>
+#include <boost/simd/function/if_plus.hpp>
+#include <boost/simd/function/is_ltz.hpp>
+#include <boost/simd/function/load.hpp>
+#include <boost/simd/function/store.hpp>
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  namespace gather_details
+  {
+    // indices are checked for runs of consecutive values by windows of
+    // that many items
+    static const long window = 64;
+    // indices handled by a thread at once
+    static const long chunk_size = 4096;
+    // items prefetched that many steps ahead, for sources of at least
+    // prefetch_bytes bytes
+    static const long prefetch_distance = 16;
+    static const long prefetch_bytes = 1 << 20;
+
+    template <class I>
+    long wrap(I index, long size)
+    {
+      return index < 0 ? index + size : index;
+    }
+
+    // whether idx[k] == idx[0] + k for k < n, once wrapped, the last index
+    // being checked first so that most windows that are not a run are
+    // rejected at once
+    template <class I>
+    bool is_run(I const *idx, long n)
+    {
+      if (idx[n - 1] != idx[0] + (n - 1) || (idx[0] < 0 && idx[n - 1] >= 0))
+        return false;
+      bool run = true;
+      for (long k = 1; k < n; ++k)
+        run &= idx[k] == idx[0] + k;
+      return run;
+    }
+
+    template <class T, class I, bool vectorize>
+    struct gather_items {
+      void operator()(T *out, T const *src, long size, I const *idx, long n,
+                      bool out_of_cache) const
+      {
+        long i = 0;
+        if (out_of_cache)
+          for (; i + prefetch_distance < n; ++i) {
+            prefetch(src + wrap(idx[i + prefetch_distance], size));
+            out[i] = src[wrap(idx[i], size)];
+          }
+        for (; i < n; ++i)
+          out[i] = src[wrap(idx[i], size)];
+      }
+    };
+
+#ifdef USE_BOOST_SIMD
+    template <class T, class I>
+    struct gather_items<T, I, true> {
+      using vector_type = boost::simd::pack<T>;
+      static const long vector_size = vector_type::static_size;
+      using offset_type = boost::simd::pack<I, vector_size>;
+
+      void operator()(T *out, T const *src, long size, I const *idx, long n,
+                      bool out_of_cache) const
+      {
+        offset_type const sizes((I)size);
+        long i = 0;
+        for (; i + vector_size <= n; i += vector_size) {
+          if (out_of_cache && i + prefetch_distance + vector_size <= n)
+            for (long j = 0; j < vector_size; ++j)
+              prefetch(src + wrap(idx[i + prefetch_distance + j], size));
+          offset_type const offsets =
+              boost::simd::load<offset_type>(idx + i);
+          boost::simd::store(
+              boost::simd::load<vector_type>(
+                  src, boost::simd::if_plus(boost::simd::is_ltz(offsets),
+                                            offsets, sizes)),
+              out + i);
+        }
+        for (; i < n; ++i)
+          out[i] = src[wrap(idx[i], size)];
+      }
+    };
+#endif
+
+    // gathers of scalars of four or eight bytes use vector gathers
+    template <class T, class I>
+    using item_kernel = gather_items<
+        T, I, types::is_vectorizable_dtype<T>::value &&
+                  (sizeof(T) == 4 || sizeof(T) == 8) &&
+                  std::is_integral<I>::value && std::is_signed<I>::value &&
+                  (sizeof(I) == 4 || sizeof(I) == 8)>;
+
+    // out[i] = src[idx[i]] for i < n, items being blocks of elements
+    template <class T, class I>
+    void gather_blocks(T *out, T const *src, long size, long block,
+                       I const *idx, long n, bool out_of_cache)
+    {
+      if (block == 1)
+        return item_kernel<T, I>{}(out, src, size, idx, n, out_of_cache);
+      for (long i = 0; i < n; ++i) {
+        if (out_of_cache && i + 1 < n)
+          prefetch(src + wrap(idx[i + 1], size) * block);
+        T const *item = src + wrap(idx[i], size) * block;
+        std::copy(item, item + block, out + i * block);
+      }
+    }
+
+    template <class T, class I>
+    void gather_chunk(T *out, T const *src, long size, long block,
+                      I const *idx, long n, bool out_of_cache)
+    {
+      // items in [start, i) are gathered one by one, runs are copied
+      long start = 0;
+      for (long i = 0; i < n; i += window) {
+        long const m = std::min(window, n - i);
+        if (is_run(idx + i, m)) {
+          gather_blocks(out + start * block, src, size, block, idx + start,
+                        i - start, out_of_cache);
+          T const *run = src + wrap(idx[i], size) * block;
+          std::copy(run, run + m * block, out + i * block);
+          start = i + m;
+        }
+      }
+      gather_blocks(out + start * block, src, size, block, idx + start,
+                    n - start, out_of_cache);
+    }
+
+    template <class F>
+    void for_each_chunk(long n, long work, bool parallel, F const &f)
+    {
+      long const nchunks = (n + chunk_size - 1) / chunk_size;
+#ifdef _OPENMP
+      if (parallel && work >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT &&
+          nchunks > 1 && !omp_in_parallel())
+#pragma omp parallel for
+        for (long c = 0; c < nchunks; ++c)
+          f(c * chunk_size, std::min(chunk_size, n - c * chunk_size));
+      else
+#endif
+        for (long c = 0; c < nchunks; ++c)
+          f(c * chunk_size, std::min(chunk_size, n - c * chunk_size));
+    }
+  }
+
+  template <class T, class I>
+  void gather(T *out, T const *src, long size, long block, I const *idx,
+              long n)
+  {
+    bool const out_of_cache =
+        size * block * (long)sizeof(T) >= gather_details::prefetch_bytes;
+    gather_details::for_each_chunk(
+        n, n * block, true, [=](long start, long m) {
+          gather_details::gather_chunk(out + start * block, src, size,
+                                       block, idx + start, m, out_of_cache);
+        });
+  }
+
+  template <class T, class I, class V>
+  void scatter(T *dst, long size, long block, I const *idx, long n,
+               V const *src, long m)
+  {
+    using namespace gather_details;
+    bool const out_of_cache = size * block * (long)sizeof(T) >= prefetch_bytes;
+    // only worth a pass over the indices when they are split among threads
+    bool increasing = false;
+#ifdef _OPENMP
+    if (n * block >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT && n > chunk_size &&
+        !omp_in_parallel()) {
+      increasing = true;
+      for (long i = 1; i < n; ++i)
+        increasing &= wrap(idx[i - 1], size) < wrap(idx[i], size);
+    }
+#endif
+
+    // runs are only copied at once when the values are not repeated
+    for_each_chunk(n, n * block, increasing, [=](long start, long count) {
+      for (long i = start, end = start + count; i < end;) {
+        long const w = std::min(window, end - i);
+        if (m == n && is_run(idx + i, w)) {
+          std::copy(src + i * block, src + (i + w) * block,
+                    dst + wrap(idx[i], size) * block);
+          i += w;
+          continue;
+        }
+        for (long j = i + w; i < j; ++i) {
+          if (out_of_cache && i + prefetch_distance < end)
+            prefetch_for_write(
+                dst + wrap(idx[i + prefetch_distance], size) * block);
+          V const *value = src + (i < m ? i : i % m) * block;
+          std::copy(value, value + block, dst + wrap(idx[i], size) * block);
+        }
+      }
+    });
+  }
+}
+PYTHONIC_NS_END
+
+#endif
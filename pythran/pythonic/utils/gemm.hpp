@@ -0,0 +1,229 @@
+#ifndef PYTHONIC_UTILS_GEMM_HPP
+#define PYTHONIC_UTILS_GEMM_HPP
+
+#include "pythonic/include/utils/gemm.hpp"
+
+#include "pythonic/utils/seq.hpp"
+#include "pythonic/utils/openmp.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <memory>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  namespace gemm_details
+  {
+    // depth of the panels, so that one panel of ``b'' stays in L1
+    static const long block_k = 256;
+    // rows of ``a'' packed at once, so that their panels stay in L2
+    static const long block_mc = 128;
+    // rows of ``a'' a thread goes through for a given panel of ``b''
+    static const long block_m = 64;
+    // columns of ``b'' packed at once
+    static const long block_n = 1024;
+    // columns of ``c'' a thread accumulates at once in gevm
+    static const long block_v = 256;
+
+    inline long round_up(long n, long step)
+    {
+      return (n + step - 1) / step * step;
+    }
+
+    /* Pack the ``mc'' x ``kc'' block of ``a'' at ``(i0, p0)'' into panels of
+     * ``MR'' rows, the last one being padded with zeros. Element ``(r, p)''
+     * of a panel is stored at ``p * MR + r''.
+     */
+    template <size_t MR, class T, class A>
+    void pack_a(T *out, A const &a, long i0, long mc, long p0, long kc)
+    {
+      for (long ir = 0; ir < mc; ir += MR, out += MR * kc) {
+        long const mr = std::min<long>(MR, mc - ir);
+        for (long r = 0; r < mr; ++r) {
+          auto &&row = a.fast(i0 + ir + r);
+          for (long p = 0; p < kc; ++p)
+            out[p * MR + r] = row.fast(p0 + p);
+        }
+        for (long r = mr; r < (long)MR; ++r)
+          for (long p = 0; p < kc; ++p)
+            out[p * MR + r] = T();
+      }
+    }
+
+    /* Pack the ``nc'' x ``kc'' block of ``b'' at ``(p0, j0)'' into panels of
+     * ``NR'' columns, the last one being padded with zeros. Element ``(p,
+     * s)'' of a panel is stored at ``p * NR + s''.
+     */
+    template <size_t NR, class T, class B>
+    void pack_b(T *out, B const &b, long j0, long nc, long p0, long kc)
+    {
+      long const npanels = round_up(nc, NR) / NR;
+      for (long p = 0; p < kc; ++p) {
+        auto &&row = b.fast(p0 + p);
+        for (long jr = 0; jr < npanels; ++jr) {
+          T *dst = out + jr * NR * kc + p * NR;
+          long const nr = std::min<long>(NR, nc - jr * NR);
+          for (long s = 0; s < nr; ++s)
+            dst[s] = row.fast(j0 + jr * NR + s);
+          for (long s = nr; s < (long)NR; ++s)
+            dst[s] = T();
+        }
+      }
+    }
+
+    // one step of the micro kernel, fully unrolled so that the accumulators
+    // end up in registers whatever the optimization level. It must be inlined
+    // in the loop of ``kernel'' for them to be vectorized.
+    template <size_t NR, class T, size_t N, size_t... I>
+    inline void multiply_add(T(&acc)[N], T const *a, T const *b,
+                             utils::index_sequence<I...>)
+    {
+      (void)std::initializer_list<int>{
+          (acc[I] += a[I / NR] * b[I % NR], 0)...};
+    }
+
+    /* Add the product of a panel of ``a'' and a panel of ``b'' to the ``mr''
+     * x ``nr'' tile of ``c'' starting at ``c'', whose rows are ``ldc''
+     * elements apart.
+     */
+    template <size_t MR, size_t NR, class T>
+    void kernel(T *c, long ldc, T const *a, T const *b, long kc, long mr,
+                long nr)
+    {
+      T acc[MR * NR] = {};
+      for (long p = 0; p < kc; ++p, a += MR, b += NR)
+        multiply_add<NR>(acc, a, b, utils::make_index_sequence<MR * NR>());
+      for (long r = 0; r < mr; ++r)
+        for (long s = 0; s < nr; ++s)
+          c[r * ldc + s] += acc[r * NR + s];
+    }
+
+    /* Add the product of the ``mc'' rows of panels of ``a'' at ``a'' and the
+     * ``nc'' columns of panels of ``b'' at ``b'' to the block of ``c'' at
+     * ``c''.
+     */
+    template <size_t MR, size_t NR, class T>
+    void macro_kernel(T *c, long ldc, T const *a, T const *b, long kc,
+                      long mc, long nc)
+    {
+      for (long j = 0; j < nc; j += NR)
+        for (long i = 0; i < mc; i += MR)
+          kernel<MR, NR>(c + i * ldc + j, ldc, a + i * kc, b + j * kc, kc,
+                         std::min<long>(MR, mc - i),
+                         std::min<long>(NR, nc - j));
+    }
+  }
+
+  template <size_t MR, size_t NR, class T, class A, class B>
+  void gemm(T *c, A const &a, B const &b, long m, long n, long k)
+  {
+    using namespace gemm_details;
+    if (m == 0 || n == 0 || k == 0)
+      return;
+
+    long const kc_max = std::min(k, block_k);
+    long const mc_max = std::min(m, block_mc);
+    long const nc_max = std::min(n, block_n);
+    std::unique_ptr<T[]> a_panels{new T[round_up(mc_max, MR) * kc_max]};
+    std::unique_ptr<T[]> b_panels{new T[round_up(nc_max, NR) * kc_max]};
+
+    // a task updates a block of rows for a group of panels of ``b''
+    long const panels_per_task = std::max<long>(1, 128 / NR);
+
+    for (long j0 = 0; j0 < n; j0 += block_n) {
+      long const nc = std::min(block_n, n - j0);
+      long const npanels = round_up(nc, NR) / NR;
+      long const col_groups = (npanels + panels_per_task - 1) / panels_per_task;
+
+      for (long p0 = 0; p0 < k; p0 += block_k) {
+        long const kc = std::min(block_k, k - p0);
+        pack_b<NR>(b_panels.get(), b, j0, nc, p0, kc);
+
+        for (long i0 = 0; i0 < m; i0 += block_mc) {
+          long const mc = std::min(block_mc, m - i0);
+          pack_a<MR>(a_panels.get(), a, i0, mc, p0, kc);
+
+          long const ntasks = (mc + block_m - 1) / block_m * col_groups;
+          T *cp = c + i0 * n + j0;
+          T const *ap = a_panels.get();
+          T const *bp = b_panels.get();
+          auto do_task = [=](long task) {
+            long const ir = (task / col_groups) * block_m;
+            long const jr = (task % col_groups) * panels_per_task;
+            macro_kernel<MR, NR>(cp + ir * n + jr * NR, n, ap + ir * kc,
+                                 bp + jr * NR * kc, kc,
+                                 std::min(block_m, mc - ir),
+                                 std::min<long>(panels_per_task * NR,
+                                                nc - jr * NR));
+          };
+#ifdef _OPENMP
+          if (ntasks > 1 && mc * nc * kc >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#pragma omp parallel for
+            for (long task = 0; task < ntasks; ++task)
+              do_task(task);
+          else
+#endif
+            for (long task = 0; task < ntasks; ++task)
+              do_task(task);
+        }
+      }
+    }
+  }
+
+  template <class T, class A, class V>
+  void gemv(T *c, A const &a, V const &v, long m, long k)
+  {
+    std::unique_ptr<T[]> w{new T[k]};
+    for (long p = 0; p < k; ++p)
+      w[p] = v.fast(p);
+    T const *wp = w.get();
+    auto do_row = [=, &a](long i) {
+      auto &&row = a.fast(i);
+      T acc = T();
+      for (long p = 0; p < k; ++p)
+        acc += row.fast(p) * wp[p];
+      c[i] = acc;
+    };
+#ifdef _OPENMP
+    if (m > 1 && m * k >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#pragma omp parallel for
+      for (long i = 0; i < m; ++i)
+        do_row(i);
+    else
+#endif
+      for (long i = 0; i < m; ++i)
+        do_row(i);
+  }
+
+  template <class T, class V, class B>
+  void gevm(T *c, V const &v, B const &b, long k, long n)
+  {
+    long const block = gemm_details::block_v;
+    long const nblocks = (n + block - 1) / block;
+    auto do_block = [=, &v, &b](long jb) {
+      long const j0 = jb * block, j1 = std::min(n, j0 + block);
+      std::fill(c + j0, c + j1, T());
+      for (long p = 0; p < k; ++p) {
+        T const vp = v.fast(p);
+        auto &&row = b.fast(p);
+        for (long j = j0; j < j1; ++j)
+          c[j] += vp * row.fast(j);
+      }
+    };
+#ifdef _OPENMP
+    if (nblocks > 1 && k * n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#pragma omp parallel for
+      for (long jb = 0; jb < nblocks; ++jb)
+        do_block(jb);
+    else
+#endif
+      for (long jb = 0; jb < nblocks; ++jb)
+        do_block(jb);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
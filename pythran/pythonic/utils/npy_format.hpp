@@ -0,0 +1,155 @@
+#ifndef PYTHONIC_UTILS_NPY_FORMAT_HPP
+#define PYTHONIC_UTILS_NPY_FORMAT_HPP
+
+#include "pythonic/include/utils/npy_format.hpp"
+
+#include "pythonic/types/str.hpp"
+#include "pythonic/__builtin__/IOError.hpp"
+
+#include <cerrno>
+#include <complex>
+#include <cstring>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  file_descriptor::file_descriptor(types::str const &filename, int flags)
+      : fd(::open(filename.get_data().c_str(), flags, 0666))
+  {
+    if (fd < 0)
+      throw types::IOError("Couldn't open file " + filename);
+  }
+
+  file_descriptor::~file_descriptor()
+  {
+    ::close(fd);
+  }
+
+  long file_descriptor::size() const
+  {
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+      return -1;
+    return st.st_size;
+  }
+
+  size_t file_descriptor::read(char *out, size_t n) const
+  {
+    size_t done = 0;
+    while (done < n) {
+      ssize_t res = ::read(fd, out + done, n - done);
+      if (res == 0)
+        break;
+      if (res < 0) {
+        if (errno == EINTR)
+          continue;
+        throw types::IOError(strerror(errno));
+      }
+      done += res;
+    }
+    return done;
+  }
+
+  void file_descriptor::write(char const *s, size_t n) const
+  {
+    while (n) {
+      ssize_t res = ::write(fd, s, n);
+      if (res < 0) {
+        if (errno == EINTR)
+          continue;
+        throw types::IOError(strerror(errno));
+      }
+      s += res;
+      n -= res;
+    }
+  }
+
+  namespace npy
+  {
+    namespace details
+    {
+      static char const magic[] = "\x93NUMPY";
+      static const size_t magic_size = sizeof(magic) - 1;
+      // the data starts on a multiple of this size
+      static const size_t alignment = 64;
+
+      template <class T>
+      struct kind {
+        static const char value = std::is_same<T, bool>::value
+                                      ? 'b'
+                                      : std::is_floating_point<T>::value
+                                            ? 'f'
+                                            : std::is_signed<T>::value ? 'i'
+                                                                       : 'u';
+      };
+
+      template <class T>
+      struct kind<std::complex<T>> {
+        static const char value = 'c';
+      };
+
+      inline char byte_order(size_t size)
+      {
+        if (size == 1)
+          return '|';
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        return '>';
+#else
+        return '<';
+#endif
+      }
+    }
+
+    template <class T>
+    std::string descr()
+    {
+      return std::string{details::byte_order(sizeof(T)),
+                         details::kind<T>::value} +
+             std::to_string(sizeof(T));
+    }
+
+    template <class T>
+    std::string write_header(long const *shape, size_t n)
+    {
+      using namespace details;
+      std::string dict = "{'descr': '" + descr<T>() +
+                         "', 'fortran_order': False, 'shape': (";
+      for (size_t i = 0; i < n; ++i)
+        dict += std::to_string(shape[i]) + (n == 1 || i + 1 < n ? "," : "") +
+                (i + 1 < n ? " " : "");
+      dict += "), }";
+
+      // version 1.0 stores the size of the dict on two bytes, 2.0 on four,
+      // and the dict ends with spaces and a newline, as numpy does
+      size_t length_size = 2;
+      size_t dict_size = dict.size() + 1;
+      dict_size += alignment - (magic_size + 2 + length_size + dict_size) %
+                                   alignment;
+      if (dict_size > 0xFFFF) {
+        length_size = 4;
+        dict_size = dict.size() + 1;
+        dict_size += alignment - (magic_size + 2 + length_size + dict_size) %
+                                     alignment;
+      }
+
+      std::string res(magic, magic_size);
+      res += length_size == 2 ? '\x01' : '\x02';
+      res += '\x00';
+      for (size_t i = 0; i < length_size; ++i)
+        res += (char)((dict_size >> (8 * i)) & 0xFF);
+      res += dict;
+      res.append(dict_size - dict.size() - 1, ' ');
+      res += '\n';
+      return res;
+    }
+  }
+}
+PYTHONIC_NS_END
+
+#endif
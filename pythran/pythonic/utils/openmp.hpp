@@ -0,0 +1,6 @@
+#ifndef PYTHONIC_UTILS_OPENMP_HPP
+#define PYTHONIC_UTILS_OPENMP_HPP
+
+#include "pythonic/include/utils/openmp.hpp"
+
+#endif
@@ -0,0 +1,259 @@
+#ifndef PYTHONIC_UTILS_PREFIX_SCAN_HPP
+#define PYTHONIC_UTILS_PREFIX_SCAN_HPP
+
+#include "pythonic/include/utils/prefix_scan.hpp"
+
+#include "pythonic/types/vectorizable_type.hpp"
+#include "pythonic/utils/openmp.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#ifdef USE_BOOST_SIMD
+#include <boost/simd/pack.hpp>
+#include <boost/simd/function/broadcast.hpp>
+#include <boost/simd/function/load.hpp>
+#include <boost/simd/function/slide.hpp>
+#include <boost/simd/function/store.hpp>
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  namespace scan_details
+  {
+    // items of a lane scanned by the same thread, whatever their number
+    static const long block_size = 1 << 14;
+    // columns of an axis scanned together
+    static const long columns = 1 << 10;
+
+    // by value, as in-place operators such as ``imul'' update their first
+    // argument
+    template <class Op, class T>
+    T apply(T left, T right)
+    {
+      return Op{}(left, right);
+    }
+
+    template <class Op, class T, class S, class Vector>
+    struct scan_block {
+      void operator()(S const *src, T *dst, long n) const
+      {
+        T acc = dst[0] = (T)src[0];
+        for (long i = 1; i < n; ++i)
+          dst[i] = acc = apply<Op, T>(acc, (T)src[i]);
+      }
+    };
+
+#ifdef USE_BOOST_SIMD
+    template <class T>
+    using vector_type = boost::simd::pack<T>;
+
+    template <class Vector>
+    struct vector_op;
+
+    template <>
+    struct vector_op<scan_sum> {
+      template <class T>
+      static T identity()
+      {
+        return T(0);
+      }
+      template <class V>
+      static V apply(V const &a, V const &b)
+      {
+        return a + b;
+      }
+    };
+
+    template <>
+    struct vector_op<scan_product> {
+      template <class T>
+      static T identity()
+      {
+        return T(1);
+      }
+      template <class V>
+      static V apply(V const &a, V const &b)
+      {
+        return a * b;
+      }
+    };
+
+    // v[i] = v[0] op ... op v[i], in log2(size) shifts of the register
+    template <class Vector, class V, size_t K, size_t L, bool = (K < L)>
+    struct in_register {
+      V operator()(V const &v, V const &identity) const
+      {
+        V const shifted = boost::simd::slide<L - K>(identity, v);
+        return in_register<Vector, V, 2 * K, L>{}(
+            vector_op<Vector>::apply(v, shifted), identity);
+      }
+    };
+
+    template <class Vector, class V, size_t K, size_t L>
+    struct in_register<Vector, V, K, L, false> {
+      V operator()(V const &v, V const &) const
+      {
+        return v;
+      }
+    };
+
+    template <class Op, class T, class Vector>
+    struct vector_scan_block {
+      void operator()(T const *src, T *dst, long n) const
+      {
+        using V = vector_type<T>;
+        static const size_t L = V::static_size;
+        V const identity(vector_op<Vector>::template identity<T>());
+        V carry = identity;
+        long i = 0;
+        for (; i + (long)L <= n; i += L) {
+          V const v = in_register<Vector, V, 1, L>{}(
+              boost::simd::load<V>(src + i), identity);
+          boost::simd::store(vector_op<Vector>::apply(carry, v), dst + i);
+          // keeps the broadcast out of the dependency chain of ``carry''
+          carry = vector_op<Vector>::apply(carry,
+                                           boost::simd::broadcast<L - 1>(v));
+        }
+        if (i == n)
+          return;
+        T acc = i ? apply<Op, T>(dst[i - 1], src[i]) : src[i];
+        dst[i] = acc;
+        for (++i; i < n; ++i)
+          dst[i] = acc = apply<Op, T>(acc, src[i]);
+      }
+    };
+
+    template <class Op, class T>
+    struct scan_block<Op, T, T, scan_sum>
+        : vector_scan_block<Op, T, scan_sum> {
+    };
+
+    template <class Op, class T>
+    struct scan_block<Op, T, T, scan_product>
+        : vector_scan_block<Op, T, scan_product> {
+    };
+#endif
+
+    // the remaining types keep the scalar scan
+    template <class T, class Vector>
+    using vector_kind = typename std::conditional<
+        types::is_vectorizable<T>::value && (sizeof(T) >= 4),
+        Vector, void>::type;
+
+    template <class Op, class T, class S>
+    void scan(S const *src, T *dst, long n)
+    {
+      scan_block<Op, T, S, vector_kind<T, typename vector_scan<Op>::type>>{}(
+          src, dst, n);
+    }
+
+    template <class Op, class T>
+    void combine(T *dst, long n, T carry)
+    {
+      for (long i = 0; i < n; ++i)
+        dst[i] = apply<Op, T>(carry, dst[i]);
+    }
+
+    template <class Op, class T, class S>
+    void parallel_scan(S const *src, T *dst, long n)
+    {
+      long const nblocks = (n + block_size - 1) / block_size;
+      std::vector<T> totals(nblocks);
+#pragma omp parallel for
+      for (long b = 0; b < nblocks; ++b) {
+        long const start = b * block_size,
+                   m = std::min(block_size, n - start);
+        scan<Op>(src + start, dst + start, m);
+        totals[b] = dst[start + m - 1];
+      }
+      for (long b = 1; b < nblocks; ++b)
+        totals[b] = apply<Op, T>(totals[b - 1], totals[b]);
+#pragma omp parallel for
+      for (long b = 1; b < nblocks; ++b) {
+        long const start = b * block_size;
+        combine<Op>(dst + start, std::min(block_size, n - start),
+                    totals[b - 1]);
+      }
+    }
+
+    // the columns [j, j + m) of the scan along the middle axis
+    template <class Op, class T, class S>
+    void scan_columns(S const *src, T *dst, long n, long inner, long m)
+    {
+      for (long j = 0; j < m; ++j)
+        dst[j] = (T)src[j];
+      for (long i = 1; i < n; ++i) {
+        T const *prev = dst + (i - 1) * inner;
+        S const *row = src + i * inner;
+        T *out = dst + i * inner;
+        for (long j = 0; j < m; ++j)
+          out[j] = apply<Op, T>(prev[j], (T)row[j]);
+      }
+    }
+  }
+
+  template <class Op, class T, class S>
+  void inclusive_scan(S const *src, T *dst, long n)
+  {
+    if (n == 0)
+      return;
+#ifdef _OPENMP
+    if (is_associative<Op>::value && n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT &&
+        n > scan_details::block_size && omp_get_max_threads() > 1 &&
+        !omp_in_parallel())
+      return scan_details::parallel_scan<Op>(src, dst, n);
+#endif
+    scan_details::scan<Op>(src, dst, n);
+  }
+
+  template <class Op, class T, class S>
+  void inclusive_scan(S const *src, T *dst, long outer, long n, long inner)
+  {
+    if (outer == 0 || n == 0 || inner == 0)
+      return;
+    if (inner == 1) {
+#ifdef _OPENMP
+      if (outer > 1 && outer * n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT &&
+          !omp_in_parallel()) {
+#pragma omp parallel for
+        for (long o = 0; o < outer; ++o)
+          scan_details::scan<Op>(src + o * n, dst + o * n, n);
+        return;
+      }
+#endif
+      for (long o = 0; o < outer; ++o)
+        inclusive_scan<Op>(src + o * n, dst + o * n, n);
+      return;
+    }
+
+    // tasks are a slice of columns of one of the outer items
+    long const slices =
+        (inner + scan_details::columns - 1) / scan_details::columns;
+    long const ntasks = outer * slices;
+    auto task = [=](long t) {
+      long const o = t / slices, j = t % slices * scan_details::columns;
+      long const offset = o * n * inner + j;
+      scan_details::scan_columns<Op>(
+          src + offset, dst + offset, n, inner,
+          std::min(scan_details::columns, inner - j));
+    };
+#ifdef _OPENMP
+    if (ntasks > 1 && outer * n * inner >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT &&
+        !omp_in_parallel()) {
+#pragma omp parallel for
+      for (long t = 0; t < ntasks; ++t)
+        task(t);
+      return;
+    }
+#endif
+    for (long t = 0; t < ntasks; ++t)
+      task(t);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
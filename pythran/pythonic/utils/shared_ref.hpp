@@ -3,6 +3,8 @@
 
 #include "pythonic/include/utils/shared_ref.hpp"
 
+#include "pythonic/utils/allocate.hpp"
+
 #include <memory>
 #include <utility>
 #include <unordered_map>
@@ -17,7 +19,8 @@ namespace utils
 
   /** Light-weight shared_ptr like-class
    *
-   *  Unlike std::shared_ptr, it allocates the memory itself using new.
+   *  Unlike std::shared_ptr, it allocates the memory itself, from the pool
+   *  of utils::allocate.
    */
   template <class T>
   template <class... Types>
@@ -26,6 +29,19 @@ namespace utils
   {
   }
 
+  template <class T>
+  template <class... Types>
+  typename shared_ref<T>::memory *shared_ref<T>::create(Types &&... args)
+  {
+    void *raw = allocate(sizeof(memory));
+    try {
+      return new (raw) memory(std::forward<Types>(args)...);
+    } catch (...) {
+      deallocate(raw, sizeof(memory));
+      throw;
+    }
+  }
+
   template <class T>
   shared_ref<T>::shared_ref(no_memory const &) noexcept : mem(nullptr)
   {
@@ -39,7 +55,7 @@ namespace utils
   template <class T>
   template <class... Types>
   shared_ref<T>::shared_ref(Types &&... args)
-      : mem(new (std::nothrow) memory(std::forward<Types>(args)...))
+      : mem(create(std::forward<Types>(args)...))
   {
   }
 
@@ -128,7 +144,8 @@ namespace utils
         Py_DECREF(mem->foreign);
       }
 #endif
-      delete mem;
+      mem->~memory();
+      deallocate(mem, sizeof(memory));
       mem = nullptr;
     }
   }
@@ -0,0 +1,303 @@
+#ifndef PYTHONIC_UTILS_STR_SEARCH_HPP
+#define PYTHONIC_UTILS_STR_SEARCH_HPP
+
+#include "pythonic/include/utils/str_search.hpp"
+
+#include "pythonic/utils/bits.hpp"
+#include <cstdint>
+#include <cstring>
+
+#ifdef USE_BOOST_SIMD
+#include <boost/simd/pack.hpp>
+#include <boost/simd/function/all.hpp>
+#include <boost/simd/function/hmsb.hpp>
+#include <boost/simd/function/if_else_zero.hpp>
+#include <boost/simd/function/is_equal.hpp>
+#include <boost/simd/function/is_less.hpp>
+#include <boost/simd/function/load.hpp>
+#include <boost/simd/function/logical_and.hpp>
+#include <boost/simd/function/logical_or.hpp>
+#include <boost/simd/function/splat.hpp>
+#include <boost/simd/function/store.hpp>
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  namespace str_search_details
+  {
+    // membership of each character, for the scalar paths
+    struct char_table {
+      bool in[256];
+      char_table(char const *set, size_t k) : in()
+      {
+        for (size_t i = 0; i < k; ++i)
+          in[(unsigned char)set[i]] = true;
+      }
+      bool operator()(char c) const
+      {
+        return in[(unsigned char)c];
+      }
+    };
+
+    inline bool is_digit(char c)
+    {
+      return (unsigned char)(c - '0') < 10;
+    }
+
+    inline bool is_alpha(char c)
+    {
+      return (unsigned char)((c | 0x20) - 'a') < 26;
+    }
+
+    long find_scalar(char const *s, size_t n, char const *needle, size_t m,
+                     size_t from)
+    {
+      // look for the first character with memchr, then check the others
+      for (char const *iter = s + from; n - (iter - s) >= m; ++iter) {
+        iter = static_cast<char const *>(
+            memchr(iter, *needle, n - (iter - s) - m + 1));
+        if (!iter)
+          return -1;
+        if (memcmp(iter + 1, needle + 1, m - 1) == 0)
+          return iter - s;
+      }
+      return -1;
+    }
+
+    /* Whether the eight characters at ``s'', or'ed with ``fold'', are all in
+     * [lo, hi]. Each byte of the sums below gets its high bit set when it is
+     * at least ``lo'', resp. more than ``hi'', which does not carry over the
+     * next byte for ASCII characters.
+     */
+    inline bool word_in_range(char const *s, unsigned char lo,
+                              unsigned char hi, unsigned char fold)
+    {
+      static const uint64_t ones = 0x0101010101010101ULL;
+      static const uint64_t highs = 0x8080808080808080ULL;
+      uint64_t x;
+      memcpy(&x, s, sizeof(x));
+      x |= fold * ones;
+      uint64_t const above_lo = x + (0x80 - lo) * ones;
+      uint64_t const above_hi = x + (0x7F - hi) * ones;
+      return (above_lo & ~above_hi & ~x & highs) == highs;
+    }
+
+#ifdef USE_BOOST_SIMD
+    using vector_type = boost::simd::pack<uint8_t>;
+    static const size_t vector_size = vector_type::static_size;
+    // larger sets are looked up in a table, one character at a time
+    static const size_t max_vector_set = 8;
+
+    inline vector_type load(char const *s)
+    {
+      return boost::simd::load<vector_type>(
+          reinterpret_cast<uint8_t const *>(s));
+    }
+
+    inline vector_type splat(char c)
+    {
+      return boost::simd::splat<vector_type>((uint8_t)c);
+    }
+
+    // bit ``i'' is set when lane ``i'' is true, for up to 64 lanes
+    template <class L>
+    uint64_t lanes(L const &l)
+    {
+      return boost::simd::hmsb(l).to_ullong();
+    }
+
+    static const uint64_t all_lanes =
+        vector_size == 64 ? ~uint64_t(0)
+                          : (uint64_t(1) << (vector_size % 64)) - 1;
+
+    // lanes of the vector at ``s'' holding one of the splatted characters
+    inline uint64_t lanes_in(char const *s, vector_type const *set,
+                                  size_t k)
+    {
+      vector_type const v = load(s);
+      auto in = v == set[0];
+      for (size_t i = 1; i < k; ++i)
+        in = boost::simd::logical_or(in, v == set[i]);
+      return lanes(in);
+    }
+#endif
+
+    // shift the characters in [first, first + 26) by ``offset''
+    void shift_range(char *out, char const *s, size_t n, char first,
+                     char offset)
+    {
+      size_t i = 0;
+#ifdef USE_BOOST_SIMD
+      vector_type const lo = splat(first), count = splat(26),
+                        shift = splat(offset);
+      for (; i + vector_size <= n; i += vector_size) {
+        vector_type const v = load(s + i);
+        boost::simd::store(
+            v + boost::simd::if_else_zero(boost::simd::is_less(v - lo, count),
+                                          shift),
+            reinterpret_cast<uint8_t *>(out + i));
+      }
+#endif
+      for (; i < n; ++i)
+        out[i] = s[i] + ((unsigned char)(s[i] - first) < 26 ? offset : 0);
+    }
+  }
+
+  long find(char const *s, size_t n, char const *needle, size_t m)
+  {
+    using namespace str_search_details;
+    if (m == 0)
+      return 0;
+    if (m > n)
+      return -1;
+    if (m == 1) {
+      auto res = static_cast<char const *>(memchr(s, *needle, n));
+      return res ? res - s : -1;
+    }
+    // matches are often close, jump to the first candidate straight away
+    auto start = static_cast<char const *>(memchr(s, needle[0], n - m + 1));
+    if (!start)
+      return -1;
+    size_t i = start - s;
+#ifdef USE_BOOST_SIMD
+    // compare the first and the last characters of the needle with whole
+    // vectors, and only check the candidates matching both
+    vector_type const first = splat(needle[0]), last = splat(needle[m - 1]);
+    for (; i + vector_size + m - 1 <= n; i += vector_size) {
+      uint64_t candidates = lanes(boost::simd::logical_and(
+          load(s + i) == first, load(s + i + m - 1) == last));
+      for (; candidates; candidates &= candidates - 1) {
+        size_t j = i + count_trailing_zeros(candidates);
+        if (memcmp(s + j + 1, needle + 1, m - 2) == 0)
+          return j;
+      }
+    }
+#endif
+    return find_scalar(s, n, needle, m, i);
+  }
+
+  long find_first_of(char const *s, size_t n, char const *set, size_t k)
+  {
+    using namespace str_search_details;
+    if (k == 1) {
+      auto res = static_cast<char const *>(memchr(s, *set, n));
+      return res ? res - s : -1;
+    }
+    size_t i = 0;
+#ifdef USE_BOOST_SIMD
+    if (k <= max_vector_set) {
+      vector_type splats[max_vector_set];
+      for (size_t j = 0; j < k; ++j)
+        splats[j] = splat(set[j]);
+      for (; i + vector_size <= n; i += vector_size)
+        if (uint64_t in = lanes_in(s + i, splats, k))
+          return i + count_trailing_zeros(in);
+    }
+#endif
+    char_table const table(set, k);
+    for (; i < n; ++i)
+      if (table(s[i]))
+        return i;
+    return -1;
+  }
+
+  long find_first_not_of(char const *s, size_t n, char const *set, size_t k)
+  {
+    using namespace str_search_details;
+    size_t i = 0;
+#ifdef USE_BOOST_SIMD
+    if (k && k <= max_vector_set) {
+      vector_type splats[max_vector_set];
+      for (size_t j = 0; j < k; ++j)
+        splats[j] = splat(set[j]);
+      for (; i + vector_size <= n; i += vector_size)
+        if (uint64_t out = ~lanes_in(s + i, splats, k) & all_lanes)
+          return i + count_trailing_zeros(out);
+    }
+#endif
+    char_table const table(set, k);
+    for (; i < n; ++i)
+      if (!table(s[i]))
+        return i;
+    return -1;
+  }
+
+  long find_last_not_of(char const *s, size_t n, char const *set, size_t k)
+  {
+    using namespace str_search_details;
+    size_t i = n;
+#ifdef USE_BOOST_SIMD
+    if (k && k <= max_vector_set) {
+      vector_type splats[max_vector_set];
+      for (size_t j = 0; j < k; ++j)
+        splats[j] = splat(set[j]);
+      for (; i >= vector_size; i -= vector_size)
+        if (uint64_t out =
+                ~lanes_in(s + i - vector_size, splats, k) & all_lanes)
+          return i - vector_size + (63 - count_leading_zeros(out));
+    }
+#endif
+    char_table const table(set, k);
+    while (i-- > 0)
+      if (!table(s[i]))
+        return i;
+    return -1;
+  }
+
+  bool all_digits(char const *s, size_t n)
+  {
+    using namespace str_search_details;
+    size_t i = 0;
+#ifdef USE_BOOST_SIMD
+    vector_type const zero = splat('0'), ten = splat(10);
+    for (; i + vector_size <= n; i += vector_size)
+      if (!boost::simd::all(boost::simd::is_less(load(s + i) - zero, ten)))
+        return false;
+#else
+    for (; i + sizeof(uint64_t) <= n; i += sizeof(uint64_t))
+      if (!word_in_range(s + i, '0', '9', 0))
+        return false;
+#endif
+    for (; i < n; ++i)
+      if (!is_digit(s[i]))
+        return false;
+    return true;
+  }
+
+  bool all_alpha(char const *s, size_t n)
+  {
+    using namespace str_search_details;
+    size_t i = 0;
+#ifdef USE_BOOST_SIMD
+    vector_type const lower = splat(0x20), a = splat('a'), count = splat(26);
+    for (; i + vector_size <= n; i += vector_size)
+      if (!boost::simd::all(
+              boost::simd::is_less((load(s + i) | lower) - a, count)))
+        return false;
+#else
+    for (; i + sizeof(uint64_t) <= n; i += sizeof(uint64_t))
+      if (!word_in_range(s + i, 'a', 'z', 0x20))
+        return false;
+#endif
+    for (; i < n; ++i)
+      if (!is_alpha(s[i]))
+        return false;
+    return true;
+  }
+
+  void to_upper(char *out, char const *s, size_t n)
+  {
+    str_search_details::shift_range(out, s, n, 'a', 'A' - 'a');
+  }
+
+  void to_lower(char *out, char const *s, size_t n)
+  {
+    str_search_details::shift_range(out, s, n, 'A', 'a' - 'A');
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef PYTHONIC_UTILS_STREAM_COMPACTION_HPP
+#define PYTHONIC_UTILS_STREAM_COMPACTION_HPP
+
+#include "pythonic/include/utils/stream_compaction.hpp"
+
+#include "pythonic/utils/bits.hpp"
+#include "pythonic/types/vectorizable_type.hpp"
+#include "pythonic/utils/openmp.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#ifdef USE_BOOST_SIMD
+#include <boost/simd/pack.hpp>
+#include <boost/simd/function/hmsb.hpp>
+#include <boost/simd/function/is_nez.hpp>
+#include <boost/simd/function/load.hpp>
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  namespace compaction_details
+  {
+    // items described by a mask word
+    static const long word_size = 64;
+    // items counted, then packed, by a thread at once
+    static const long chunk_size = 256 * word_size;
+
+    // bit ``j'' is set when data[j] is non zero, for j < m
+    template <class T>
+    uint64_t partial_word(T const *data, long m)
+    {
+      uint64_t word = 0;
+      for (long j = 0; j < m; ++j)
+        word |= (uint64_t)(data[j] != T()) << j;
+      return word;
+    }
+
+    template <class T, bool vectorize>
+    struct nonzero_word {
+      uint64_t operator()(T const *data) const
+      {
+        return partial_word(data, word_size);
+      }
+    };
+
+#ifdef USE_BOOST_SIMD
+    template <class T>
+    struct nonzero_word<T, true> {
+      using vector_type = boost::simd::pack<T>;
+      static const long vector_size = vector_type::static_size;
+
+      uint64_t operator()(T const *data) const
+      {
+        uint64_t word = 0;
+        for (long j = 0; j < word_size; j += vector_size) {
+          vector_type const v = boost::simd::load<vector_type>(data + j);
+          auto const lanes = boost::simd::hmsb(boost::simd::is_nez(v));
+          word |= (uint64_t)lanes.to_ullong() << j;
+        }
+        return word;
+      }
+    };
+#endif
+
+    // booleans are stored as bytes holding 0 or 1
+    template <>
+    struct nonzero_word<bool, false> {
+      uint64_t operator()(bool const *data) const
+      {
+#ifdef USE_BOOST_SIMD
+        return nonzero_word<uint8_t, true>{}(
+            reinterpret_cast<uint8_t const *>(data));
+#elif __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        // the product gathers the low bit of each of the eight bytes in the
+        // top byte, the first byte being the lowest bit
+        uint64_t word = 0;
+        for (long j = 0; j < word_size; j += 8) {
+          uint64_t bytes;
+          memcpy(&bytes, data + j, sizeof(bytes));
+          word |= ((bytes * 0x0102040810204080ULL) >> 56) << j;
+        }
+        return word;
+#else
+        return partial_word(data, word_size);
+#endif
+      }
+    };
+
+    template <class T>
+    using word_kernel =
+        nonzero_word<T, types::is_vectorizable_dtype<T>::value>;
+
+    template <class T>
+    long count(T const *data, long n)
+    {
+      word_kernel<T> kernel;
+      long total = 0, i = 0;
+      for (; i + word_size <= n; i += word_size)
+        total += popcount(kernel(data + i));
+      if (i < n)
+        total += popcount(partial_word(data + i, n - i));
+      return total;
+    }
+
+    // calls f(k, base + i) for each non zero data[i], k counting from ``k''
+    template <class T, class F>
+    void pack(T const *data, long n, long base, long k, F const &f)
+    {
+      word_kernel<T> kernel;
+      for (long i = 0; i < n; i += word_size) {
+        uint64_t word = i + word_size <= n ? kernel(data + i)
+                                           : partial_word(data + i, n - i);
+        for (; word; word &= word - 1)
+          f(k++, base + i + count_trailing_zeros(word));
+      }
+    }
+
+    template <class F>
+    void for_each_chunk(long n, F const &f)
+    {
+      long const nchunks = (n + chunk_size - 1) / chunk_size;
+#ifdef _OPENMP
+      if (n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT && nchunks > 1 &&
+          !omp_in_parallel())
+#pragma omp parallel for
+        for (long c = 0; c < nchunks; ++c)
+          f(c, c * chunk_size, std::min(chunk_size, n - c * chunk_size));
+      else
+#endif
+        for (long c = 0; c < nchunks; ++c)
+          f(c, c * chunk_size, std::min(chunk_size, n - c * chunk_size));
+    }
+  }
+
+  template <class T>
+  nonzero_compaction<T>::nonzero_compaction(T const *data, long n)
+      : data(data), n(n),
+        offsets((n + compaction_details::chunk_size - 1) /
+                    compaction_details::chunk_size +
+                1)
+  {
+    long *counts = offsets.data() + 1;
+    compaction_details::for_each_chunk(
+        n, [data, counts](long c, long start, long m) {
+          counts[c] = compaction_details::count(data + start, m);
+        });
+    for (size_t c = 1; c < offsets.size(); ++c)
+      offsets[c] += offsets[c - 1];
+  }
+
+  template <class T>
+  long nonzero_compaction<T>::size() const
+  {
+    return offsets.back();
+  }
+
+  template <class T>
+  template <class F>
+  void nonzero_compaction<T>::operator()(F const &f) const
+  {
+    T const *data = this->data;
+    long const *offsets = this->offsets.data();
+    compaction_details::for_each_chunk(
+        n, [data, offsets, &f](long c, long start, long m) {
+          compaction_details::pack(data + start, m, start, offsets[c], f);
+        });
+  }
+
+  template <class T, size_t N>
+  types::ndarray<T, N> const &dense(types::ndarray<T, N> const &e)
+  {
+    return e;
+  }
+
+  template <class E>
+  types::ndarray<typename E::dtype, E::value> dense(E const &e)
+  {
+    return types::ndarray<typename E::dtype, E::value>(e);
+  }
+}
+PYTHONIC_NS_END
+
+#endif
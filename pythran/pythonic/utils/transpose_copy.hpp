@@ -0,0 +1,172 @@
+#ifndef PYTHONIC_UTILS_TRANSPOSE_COPY_HPP
+#define PYTHONIC_UTILS_TRANSPOSE_COPY_HPP
+
+#include "pythonic/include/utils/transpose_copy.hpp"
+
+#include "pythonic/types/vectorizable_type.hpp"
+#include "pythonic/utils/seq.hpp"
+#include "pythonic/utils/openmp.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <utility>
+#include <memory>
+
+#ifdef USE_BOOST_SIMD
+#include <boost/simd/pack.hpp>
+#include <boost/simd/function/load.hpp>
+#include <boost/simd/function/store.hpp>
+#include <boost/simd/function/interleave_first.hpp>
+#include <boost/simd/function/interleave_second.hpp>
+#endif
+
+PYTHONIC_NS_BEGIN
+
+namespace utils
+{
+
+  namespace details
+  {
+    /* scalar transposition of a ``rows'' x ``cols'' block */
+    template <class T>
+    void transpose_block(T *dst, long dst_stride, T const *src,
+                         long src_stride, long rows, long cols)
+    {
+      for (long i = 0; i < rows; ++i)
+        for (long j = 0; j < cols; ++j)
+          dst[i * dst_stride + j] = src[j * src_stride + i];
+    }
+
+    template <class T, bool vectorize>
+    struct transpose_tile {
+      void operator()(T *dst, long dst_stride, T const *src, long src_stride,
+                      long rows, long cols) const
+      {
+        transpose_block(dst, dst_stride, src, src_stride, rows, cols);
+      }
+    };
+
+#ifdef USE_BOOST_SIMD
+    /* In-register transposition of a square block of vN x vN elements,
+     * using log2(vN) rounds of interleaving
+     */
+    template <class T>
+    struct transpose_tile<T, true> {
+      // interleaving across 128 bits lanes is costly, so stick to 128 bits
+      using vT = boost::simd::pack<T, 16 / sizeof(T)>;
+      static const long vN = vT::static_size;
+
+      template <size_t... I>
+      static void interleave(vT *out, vT const *in, utils::index_sequence<I...>)
+      {
+        std::initializer_list<int>{
+            ((out[2 * I] = boost::simd::interleave_first(in[I], in[I + vN / 2])),
+             (out[2 * I + 1] =
+                  boost::simd::interleave_second(in[I], in[I + vN / 2])),
+             0)...};
+      }
+
+      static void transpose_pack(T *dst, long dst_stride, T const *src,
+                                 long src_stride)
+      {
+        vT buffers[2][vN];
+        vT *rows = buffers[0], *tmp = buffers[1];
+        for (long k = 0; k < vN; ++k)
+          rows[k] = boost::simd::load<vT>(src + k * src_stride);
+        for (long w = 1; w < vN; w *= 2) {
+          interleave(tmp, rows, utils::make_index_sequence<vN / 2>{});
+          std::swap(rows, tmp);
+        }
+        for (long k = 0; k < vN; ++k)
+          boost::simd::store(rows[k], dst + k * dst_stride);
+      }
+
+      void operator()(T *dst, long dst_stride, T const *src, long src_stride,
+                      long rows, long cols) const
+      {
+        long const vrows = rows - rows % vN, vcols = cols - cols % vN;
+        for (long i = 0; i < vrows; i += vN)
+          for (long j = 0; j < vcols; j += vN)
+            transpose_pack(dst + i * dst_stride + j, dst_stride,
+                           src + j * src_stride + i, src_stride);
+        // right border
+        if (vcols != cols)
+          transpose_block(dst + vcols, dst_stride, src + vcols * src_stride,
+                          src_stride, vrows, cols - vcols);
+        // bottom border
+        if (vrows != rows)
+          transpose_block(dst + vrows * dst_stride, dst_stride, src + vrows,
+                          src_stride, rows - vrows, cols);
+      }
+    };
+#endif
+  }
+
+  template <class T>
+  void transpose_copy(T *dst, long dst_stride, T const *src, long src_stride,
+                      long rows, long cols)
+  {
+    static const long tile = PYTHRAN_TRANSPOSE_TILE_SIZE;
+    long const row_tiles = (rows + tile - 1) / tile,
+               col_tiles = (cols + tile - 1) / tile,
+               ntiles = row_tiles * col_tiles;
+
+    // the source and the destination overlap, e.g. in ``a[:] = a.T''
+    // transposition in place is not supported, so go through a temporary
+    if (src < dst + rows * dst_stride && dst < src + cols * src_stride) {
+      std::unique_ptr<T[]> tmp{new T[cols * src_stride]};
+      std::copy(src, src + cols * src_stride, tmp.get());
+      return transpose_copy(dst, dst_stride, tmp.get(), src_stride, rows,
+                            cols);
+    }
+
+    details::transpose_tile<T, types::is_vectorizable_dtype<T>::value> kernel;
+    auto do_tile = [=](long t) {
+      long const i = (t / col_tiles) * tile, j = (t % col_tiles) * tile;
+      kernel(dst + i * dst_stride + j, dst_stride, src + j * src_stride + i,
+             src_stride, std::min(tile, rows - i), std::min(tile, cols - j));
+    };
+
+#ifdef _OPENMP
+    if (rows * cols >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT && ntiles > 1 &&
+        !omp_in_parallel())
+#pragma omp parallel for
+      for (long t = 0; t < ntiles; ++t)
+        do_tile(t);
+    else
+#endif
+      for (long t = 0; t < ntiles; ++t)
+        do_tile(t);
+  }
+
+  template <class T>
+  T *transpose_buffer<types::ndarray<T, 2>>::data(types::ndarray<T, 2> &self)
+  {
+    return self.buffer;
+  }
+
+  template <class T>
+  long transpose_buffer<types::ndarray<T, 2>>::stride(
+      types::ndarray<T, 2> const &self)
+  {
+    return self.shape()[1];
+  }
+
+  template <class Arg, class... S>
+  typename transpose_buffer<types::numpy_gexpr<Arg, S...>>::dtype *
+  transpose_buffer<types::numpy_gexpr<Arg, S...>>::data(
+      types::numpy_gexpr<Arg, S...> &self)
+  {
+    return self.buffer;
+  }
+
+  template <class Arg, class... S>
+  long transpose_buffer<types::numpy_gexpr<Arg, S...>>::stride(
+      types::numpy_gexpr<Arg, S...> const &self)
+  {
+    return self.arg.shape()[1];
+  }
+}
+PYTHONIC_NS_END
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef PYTHONIC_UTILS_UNIT_STATE_HPP
+#define PYTHONIC_UTILS_UNIT_STATE_HPP
+
+#include "pythonic/include/utils/unit_state.hpp"
+
+#endif
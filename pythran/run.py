@@ -105,6 +105,14 @@ def run():
                              'the underlying C++ compiler',
                         default=list())
 
+    parser.add_argument('-j', dest='jobs', metavar='N', type=int, default=1,
+                        help='split the generated C++ code into N '
+                        'translation units compiled concurrently')
+
+    parser.add_argument('--no-cache', dest='cache', action='store_false',
+                        help='compile even if the module is in the cache '
+                        'of compiled modules, and do not add it there')
+
     parser.convert_arg_line_to_args = convert_arg_line_to_args
 
     args, extra = parser.parse_known_args(sys.argv[1:])
@@ -139,6 +147,7 @@ def run():
                                      args.input_file))
             pythran.compile_cxxfile(module_name,
                                     args.input_file, args.output_file,
+                                    cache=args.cache,
                                     **compile_flags(args))
 
         else:  # assume we have a .py input file here
@@ -147,6 +156,8 @@ def run():
                                         output_file=args.output_file,
                                         cpponly=args.translate_only,
                                         pyonly=args.optimize_only,
+                                        jobs=args.jobs,
+                                        cache=args.cache,
                                         **compile_flags(args))
 
     except IOError as e:
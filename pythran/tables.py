@@ -839,6 +839,9 @@ CLASSES = {
                 Fun[[NDArray[complex, :, :, :, :]], List[complex]],
             ]
         ),
+        "tofile": ConstMethodIntr(args=('self', 'fid', 'sep'),
+                                  defaults=("",),
+                                  global_effects=True),
         "tostring": ConstMethodIntr(signature=Fun[[NDArray[T0, :]], str]),
     },
 }
@@ -2567,7 +2570,18 @@ _numpy_array_signature = Union[
 MODULES = {
     "__builtin__": {
         "pythran": {
-            "len_set": ConstFunctionIntr(signature=Fun[[Iterable[T0]], int])
+            "len_set": ConstFunctionIntr(signature=Fun[[Iterable[T0]], int]),
+            "parallel_map": ReadOnceFunctionIntr(
+                signature=Union[
+                    Fun[[Fun[[T0], T7], Iterable[T0]], List[T7]],
+                    Fun[[Fun[[T0, T1], T7], Iterable[T0], Iterable[T1]],
+                        List[T7]],
+                    Fun[[Fun[[T0, T1, T2], T7], Iterable[T0], Iterable[T1],
+                         Iterable[T2]], List[T7]],
+                    Fun[[Fun[[T0, T1, T2, T3], T7], Iterable[T0],
+                         Iterable[T1], Iterable[T2], Iterable[T3]], List[T7]],
+                ]
+            ),
         },
         "abs": ConstFunctionIntr(
             signature=Union[
@@ -3136,6 +3150,8 @@ MODULES = {
             signature=_numpy_unary_op_int_axis_signature),
         "argmin": ConstMethodIntr(
             signature=_numpy_unary_op_int_axis_signature),
+        "argpartition": ConstFunctionIntr(args=('a', 'kth', 'axis'),
+                                          defaults=(-1,)),
         "argsort": ConstFunctionIntr(
             signature=_numpy_unary_op_int_axis_signature),
         "argwhere": ConstFunctionIntr(signature=_numpy_unary_op_int_signature),
@@ -3680,6 +3696,9 @@ MODULES = {
         "fmin": UFunc(BINARY_UFUNC),
         "fmod": UFunc(BINARY_UFUNC),
         "frexp": ConstFunctionIntr(),
+        "fromfile": FunctionIntr(args=('file', 'dtype', 'count', 'sep'),
+                                 defaults=("numpy.float64", -1, ""),
+                                 global_effects=True),
         "fromfunction": ConstFunctionIntr(),
         "fromiter": ConstFunctionIntr(),
         "fromstring": ConstFunctionIntr(),
@@ -3762,8 +3781,14 @@ MODULES = {
             signature=_numpy_binary_op_signature
         ),
         "mean": ConstMethodIntr(),
+        "memmap": FunctionIntr(
+            args=('filename', 'dtype', 'mode', 'offset', 'shape'),
+            defaults=("numpy.uint8", "r+", 0, None),
+            global_effects=True),
         "median": ConstFunctionIntr(
-            signature=_numpy_unary_op_sum_axis_signature
+            signature=_numpy_unary_op_sum_axis_signature,
+            args=('a', 'axis'),
+            defaults=(None,)
         ),
         "min": ConstMethodIntr(signature=_numpy_unary_op_axis_signature),
         "minimum": UFunc(
@@ -3795,6 +3820,10 @@ MODULES = {
         "ones": ConstFunctionIntr(signature=_numpy_ones_signature),
         "ones_like": ConstFunctionIntr(signature=_numpy_ones_like_signature),
         "outer": ConstFunctionIntr(),
+        "partition": ConstFunctionIntr(args=('a', 'kth', 'axis'),
+                                       defaults=(-1,)),
+        "percentile": ConstFunctionIntr(args=('a', 'q', 'axis'),
+                                        defaults=(None,)),
         "pi": ConstantIntr(),
         "place": FunctionIntr(),
         "power": UFunc(
@@ -3806,6 +3835,8 @@ MODULES = {
         "ptp": ConstMethodIntr(),
         "put": MethodIntr(),
         "putmask": FunctionIntr(),
+        "quantile": ConstFunctionIntr(args=('a', 'q', 'axis'),
+                                      defaults=(None,)),
         "rad2deg": ConstFunctionIntr(
             signature=_numpy_float_unary_op_float_signature
         ),
@@ -3863,6 +3894,7 @@ MODULES = {
         "rot90": ConstFunctionIntr(),
         "round": ConstMethodIntr(),
         "round_": ConstMethodIntr(),
+        "save": FunctionIntr(args=('file', 'arr'), global_effects=True),
         "searchsorted": ConstFunctionIntr(),
         "select": ConstFunctionIntr(),
         "shape": ConstFunctionIntr(),
@@ -3872,7 +3904,8 @@ MODULES = {
         "sinh": ConstFunctionIntr(signature=_numpy_unary_op_float_signature),
         "size": ConstFunctionIntr(return_range=interval.positive_values),
         "sometrue": ConstFunctionIntr(),
-        "sort": ConstFunctionIntr(),
+        "sort": ConstFunctionIntr(args=('a', 'axis', 'kind'),
+                                  defaults=(-1, 'quicksort')),
         "sort_complex": ConstFunctionIntr(),
         "spacing": ConstFunctionIntr(),
         "split": ConstFunctionIntr(),
@@ -0,0 +1,10 @@
+#pythran export dict_churn(str list)
+#runas dict_churn(["the", "quick", "brown", "fox", "jumps", "over", "the", "lazy", "dog"] * 10)
+#bench words = [str(i * 7919) for i in xrange(1000000)]; dict_churn(words)
+def dict_churn(words):
+    index = dict()
+    for i, word in enumerate(words):
+        index[word] = words[-1 - i]
+    for word in words[::3]:
+        index.pop(word, "")
+    return len(index), sum(len(index[word]) for word in words if word in index)
@@ -0,0 +1,20 @@
+#pythran export dispatch_overloads(int)
+#pythran export dispatch_overloads(float)
+#pythran export dispatch_overloads(str)
+#pythran export dispatch_overloads(int list)
+#pythran export dispatch_overloads(float list)
+#pythran export dispatch_overloads(str list)
+#pythran export dispatch_overloads(int set)
+#pythran export dispatch_overloads(str:int dict)
+#pythran export dispatch_overloads(int, int)
+#pythran export dispatch_overloads(float, int)
+#pythran export dispatch_overloads(str, str)
+#pythran export dispatch_overloads((int, int))
+#pythran export dispatch_overloads((float, float))
+#pythran export dispatch_overloads((str, float))
+#pythran export dispatch_overloads(complex)
+#pythran export dispatch_overloads(bool)
+#runas [dispatch_overloads(*args) for args in [(1,), (1.,), ("a",), ([1],), ([1.],), (["a"],), ({1},), ({"a": 1},), (1, 2), (1., 2), ("a", "b"), ((1, 2),), ((1., 2.),), (("a", 1.),), (1j,), (True,)]] + [dispatch_overloads(x=1., y=2), dispatch_overloads(y="b", x="a")]
+#bench args = [(1.,), ((1., 2.),), ("a", "b"), (True,)] * 50000; [dispatch_overloads(*a) for a in args]
+def dispatch_overloads(x, y=None):
+    return x, y
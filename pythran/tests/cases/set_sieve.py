@@ -0,0 +1,9 @@
+#pythran export set_sieve(int)
+#runas set_sieve(1000)
+#bench set_sieve(2000000)
+def set_sieve(n):
+    composites = set()
+    for i in xrange(2, int(n ** .5) + 1):
+        if i not in composites:
+            composites.update(xrange(i * i, n, i))
+    return [i for i in xrange(2, n) if i not in composites]
@@ -0,0 +1,10 @@
+#pythran export str_scan(str, str)
+#runas str_scan("the quick brown fox 12 jumps over the lazy dog 345 " * 10, " \n" * 10)
+#bench line = "the quick brown fox 12 jumps over the lazy dog 345 " * 200000; pad = " \n" * 1000000; str_scan(line, pad)
+def str_scan(line, pad):
+    words = line.strip().split(' ')
+    digits = [w for w in words if w.isdigit()]
+    padded = pad + line + pad
+    return (len(words), len(digits), padded.strip() == line.strip(),
+            line.upper().count("THE"), line.find("lazy cat"),
+            line.replace("fox", "cat").count("cat"))
@@ -0,0 +1,17 @@
+#pythran export str_scan_kernels(str, int)
+#runas str_scan_kernels("abcdefghijklmnopqrstuvwxyz0123456789 " * 10, 3)
+#bench text = "abcdefghijklmnopqrstuvwxyz0123456789 " * 100000; str_scan_kernels(text, 20)
+def str_scan_kernels(text, repeat):
+    # each kernel of the scan path in isolation, on inputs it reads whole
+    text = text + "needle"
+    digits = "7" * len(text)
+    spaces = " " * len(text) + "x" + "\n" * len(text)
+    found = counted = words = stripped = isdigit = upper = 0
+    for _ in range(repeat):
+        found += text.find("needle")
+        counted += text.count("ab")
+        words += len(text.split())
+        stripped += len(spaces.strip())
+        isdigit += 1 if digits.isdigit() else 0
+        upper += len(text.upper())
+    return found, counted, words, stripped, isdigit, upper
@@ -0,0 +1,8 @@
+#pythran export word_count(str list)
+#runas word_count(["the", "quick", "brown", "fox", "jumps", "over", "the", "lazy", "dog"] * 10)
+#bench import random; words = [str(random.randint(0, 50000)) for i in xrange(2000000)]; word_count(words)
+def word_count(words):
+    counts = dict()
+    for word in words:
+        counts[word] = counts.get(word, 0) + 1
+    return counts
@@ -0,0 +1,11 @@
+import numpy as np
+
+def numpy_random():
+    n = 10000
+    draws = np.empty(n)
+    #pragma omp parallel for
+    for i in range(n):
+        draws[i] = np.random.random()
+    bulk = np.random.normal(2., 1., 100000)
+    return (abs(np.mean(draws) - .5) < .05 and len(set(draws)) == n and
+            abs(np.mean(bulk) - 2.) < .05)
@@ -0,0 +1,8 @@
+def omp_escape_list():
+    n = 10000
+    rows = [[0] for i in range(n)]
+    #omp parallel for
+    for i in range(n):
+        rows[i] = [i, i + 1]
+        rows[i].append(len(rows[i]))
+    return rows
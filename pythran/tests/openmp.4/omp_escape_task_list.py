@@ -0,0 +1,11 @@
+def omp_escape_task_list():
+    n = 10000
+    total = 0
+    #omp parallel
+    #omp single
+    for i in range(n):
+        l = [i, i + 1]
+        #omp task firstprivate(l)
+        #omp atomic
+        total += len(l) + l[1] - l[0]
+    return total
@@ -0,0 +1,6 @@
+def parallel_map():
+    n = 10000
+    squares = [i * i for i in range(n)]
+    sums = map(lambda x, y: x + y, squares, range(n))
+    names = [str(i) for i in range(n)]
+    return sum(squares), list(sums)[-3:], names[-3:]
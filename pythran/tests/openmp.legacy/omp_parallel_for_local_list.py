@@ -0,0 +1,8 @@
+def omp_parallel_for_local_list():
+    total = 0
+    'omp parallel for reduction(+:total)'
+    for i in range(1000):
+        l = [i, i + 1, i + 2]
+        l.append(i)
+        total += len(l) + l[-1]
+    return total == 4 * 1000 + 999 * 1000 / 2
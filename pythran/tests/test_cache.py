@@ -0,0 +1,78 @@
+from pythran.cache import cache_key
+from pythran.config import cfg, make_extension
+from pythran.pch import bundle, precompiled_header
+import pythran
+import pythran.toolchain
+
+import os
+import shutil
+import tempfile
+import unittest
+
+
+class TestCache(unittest.TestCase):
+
+    code = '#pythran export cached(int)\ndef cached(n): return n + 1'
+
+    def setUp(self):
+        self.cache_dir = tempfile.mkdtemp()
+        self.saved_cache_dir = cfg.get('pythran', 'cache_dir')
+        cfg.set('pythran', 'cache_dir', self.cache_dir)
+
+    def tearDown(self):
+        cfg.set('pythran', 'cache_dir', self.saved_cache_dir)
+        shutil.rmtree(self.cache_dir)
+
+    def test_cache_reuse(self):
+        first = pythran.compile_pythrancode('test_cache_reuse', self.code)
+        os.remove(first)
+        self.assertEqual(len(os.listdir(self.cache_dir)), 1)
+
+        # a hit must not compile anything
+        setup, pythran.toolchain.setup = pythran.toolchain.setup, None
+        try:
+            second = pythran.compile_pythrancode('test_cache_reuse',
+                                                 self.code)
+        finally:
+            pythran.toolchain.setup = setup
+        self.assertEqual(first, second)
+        os.remove(second)
+
+    def test_precompiled_header(self):
+        output = pythran.compile_pythrancode('test_precompiled_header',
+                                             self.code)
+        os.remove(output)
+        headers = [entry for entry in os.listdir(self.cache_dir)
+                   if entry.startswith('pch-')]
+        self.assertEqual(len(headers), 1)
+
+    def test_precompiled_header_prefixes(self):
+        # a single header is included by all the files, so they must agree
+        cxxfiles = []
+        for macro in ('FIRST', 'SECOND'):
+            fd, cxxfile = tempfile.mkstemp(suffix='.cpp', dir=self.cache_dir)
+            with os.fdopen(fd, 'w') as out:
+                out.write('#define {} 1\n'.format(macro))
+                out.writelines('#include <{}>\n'.format(header)
+                               for header in bundle)
+            cxxfiles.append(cxxfile)
+        self.assertIsNone(precompiled_header(cxxfiles, make_extension()))
+
+    def test_no_cache(self):
+        output = pythran.compile_pythrancode('test_no_cache', self.code,
+                                             cache=False)
+        os.remove(output)
+        self.assertEqual(os.listdir(self.cache_dir), [])
+
+    def test_key_link_flags(self):
+        fd, cxxfile = tempfile.mkstemp(suffix='.cpp', dir=self.cache_dir)
+        os.close(fd)
+        extension_args = make_extension()
+        key = cache_key('test_key_link_flags', [cxxfile], extension_args)
+        extension_args['extra_link_args'].append('-s')
+        self.assertNotEqual(key, cache_key('test_key_link_flags', [cxxfile],
+                                           extension_args))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -1,4 +1,6 @@
+from array import array
 import numpy as np
+import sys
 import unittest
 from pythran.typing import *
 
@@ -27,6 +29,26 @@ class TestConversion(TestEnv):
     def test_list_of_float64(self):
         self.run_test('def list_of_float64(l): return [2. * _ for _ in l]', [1.,2.], list_of_float64=[List[np.float64]])
 
+    @unittest.skipIf(sys.version_info.major == 2, "no buffer interface")
+    def test_list_of_float64_from_array(self):
+        self.run_test('def list_of_float64_from_array(l): return [2. * _ for _ in l]', array('d', [1.,2.]), list_of_float64_from_array=[List[np.float64]])
+
+    @unittest.skipIf(sys.version_info.major == 2, "no buffer interface")
+    def test_list_of_int_from_int32_array(self):
+        self.run_test('def list_of_int_from_int32_array(l): return sum(l), len(l)', array('i', [1,-2,3]), list_of_int_from_int32_array=[List[int]])
+
+    @unittest.skipIf(sys.version_info.major == 2, "no buffer interface")
+    def test_list_of_int_from_uint32_array(self):
+        self.run_test('def list_of_int_from_uint32_array(l): return sum(l), len(l)', array('I', [2**32 - 1, 1]), list_of_int_from_uint32_array=[List[int]])
+
+    @unittest.skipIf(sys.version_info.major == 2, "no buffer interface")
+    def test_list_of_int_from_uint64_array(self):
+        """ Check unsigned 64 bit items, that may not fit, are rejected. """
+        code = 'def list_of_int_from_uint64_array(l): return sum(l)'
+        with self.assertRaises(BaseException):
+            self.run_test(code, array('Q', [2**63, 1]),
+                          list_of_int_from_uint64_array=[List[int]])
+
     @unittest.skip("No np.float32 python_to_pythran converter exists.")
     def test_set_of_float32(self):
         """ Check np.float32 conversion. """
@@ -115,3 +115,12 @@ def dict_copy(a):
 
     def test_dict_setdefault_combiner(self):
         return self.run_test("def dict_setdefault_combiner():\n a=dict()\n a.setdefault(1,'e')\n return a", dict_setdefault_combiner=[])
+
+    def test_dict_erase_many(self):
+        return self.run_test("def dict_erase_many(n):\n a={i:str(i) for i in range(n)}\n for i in range(0, n, 3): a.pop(i)\n for i in range(n, 2 * n): a[i] = str(-i)\n for i in range(1, 2 * n, 2): a.pop(i, '')\n return sorted(a.items())", 1000, dict_erase_many=[int])
+
+    def test_dict_pop_into_other_key(self):
+        return self.run_test("def dict_pop_into_other_key(n):\n a={i:[i] for i in range(n)}\n for i in range(n - 2): a[n - 1] = a.pop(i)\n return sorted(a.items())", 1000, dict_pop_into_other_key=[int])
+
+    def test_dict_float_keys(self):
+        return self.run_test("def dict_float_keys(a):\n d={}\n for x in a: d[x] = d.get(x, 0) + 1\n return sorted(d.items())", [0., -0., 1.5, 1.5, -2.], dict_float_keys=[List[float]])
@@ -0,0 +1,93 @@
+from pythran.typing import List, NDArray
+
+from test_env import TestEnv
+
+
+class TestDispatch(TestEnv):
+
+    """ Check the selection of the overloads of exported functions. """
+
+    # outcome of a call, so that errors compare like values
+    attempt = '''
+def attempt(f, *args, **kwargs):
+    try:
+        return f(*args, **kwargs)
+    except TypeError:
+        return "TypeError"
+'''
+
+    def test_keyword_arguments(self):
+        code = 'def keyword_arguments(a, b): return a, b'
+        runas = ('[keyword_arguments(1, b=2.), '
+                 'keyword_arguments(a=1, b=2.), '
+                 'keyword_arguments(b=2., a=1.5)]')
+        self.run_test_case(code, 'test_keyword_arguments', runas,
+                           keyword_arguments=([int, float], [float, float]))
+
+    def test_invalid_keyword_arguments(self):
+        code = 'def invalid_keyword_arguments(a, b): return a, b'
+        runas = self.attempt + ''';[
+    attempt(invalid_keyword_arguments, 1, c=2.),
+    attempt(invalid_keyword_arguments, 1, a=2),
+    attempt(invalid_keyword_arguments, b=2.),
+    attempt(invalid_keyword_arguments, 1),
+    attempt(invalid_keyword_arguments, 1, 2., b=3.)]'''
+        self.run_test_case(code, 'test_invalid_keyword_arguments', runas,
+                           invalid_keyword_arguments=([int, float],
+                                                      [float, float]))
+
+    def test_many_fingerprints(self):
+        code = '''
+import numpy as np
+def many_fingerprints(a): return np.sum(a)'''
+        # more argument types than the dispatch table holds, twice over;
+        # Python accepts them all, so the expected outcome of the types
+        # that are not exported is set apart
+        runas = self.attempt + '''
+import numpy as np
+native = not hasattr(many_fingerprints, '__code__')
+arrays = [np.arange(2 ** rank, dtype=dtype).reshape((2,) * rank)
+          for dtype in (np.int8, np.int16, np.int32, np.int64, np.uint8,
+                        np.uint16, np.uint32, np.uint64, np.float32,
+                        np.float64, np.complex64, np.complex128)
+          for rank in (1, 2, 3)]
+exported = [a.dtype in (np.int64, np.float64) and a.ndim < 3
+            for a in arrays]
+results = [attempt(many_fingerprints, a) for a in arrays + arrays]
+;[r if ok or native else "TypeError"
+  for ok, r in zip(exported + exported, results)]'''
+        self.run_test_case(code, 'test_many_fingerprints', runas,
+                           many_fingerprints=([NDArray[int, :]],
+                                              [NDArray[float, :]],
+                                              [NDArray[int, :, :]],
+                                              [NDArray[float, :, :]]))
+
+    def test_ndarray_subclass(self):
+        code = '''
+import numpy as np
+def ndarray_subclass(a): return np.sum(a)'''
+        # instances of classes created at run time are never cached
+        runas = '''
+import numpy as np
+class Sub(np.ndarray):
+    pass
+;[float(ndarray_subclass(np.arange(4.).view(Sub))),
+  float(ndarray_subclass(np.arange(4).view(Sub))),
+  float(ndarray_subclass(np.arange(4.))),
+  float(ndarray_subclass(np.arange(4.).view(Sub)))]'''
+        self.run_test_case(code, 'test_ndarray_subclass', runas,
+                           ndarray_subclass=([NDArray[int, :]],
+                                             [NDArray[float, :]]))
+
+    def test_failed_conversion(self):
+        code = 'def failed_conversion(l): return sum(l)'
+        # only the first item of a list selects the overload, so the failing
+        # calls share the fingerprint of the valid ones
+        runas = self.attempt + ''';[
+    failed_conversion([1, 2, 3]),
+    attempt(failed_conversion, [1, 2, 'x']),
+    attempt(failed_conversion, [1.5, None]),
+    failed_conversion([1, 2, 3]),
+    failed_conversion([1.5, 2.5])]'''
+        self.run_test_case(code, 'test_failed_conversion', runas,
+                           failed_conversion=([List[int]], [List[float]]))
@@ -229,3 +229,12 @@ def file_close(filename):
     def test_xreadlines(self):
         self.tempfile()
         self.run_test("""def _xreadlines(filename):\n f= open(filename)\n return [l for l in f.xreadlines()]""", self.filename, _xreadlines=[str])
+
+    def test_long_lines(self):
+        self.file_content = ("x" * 100000 + "\n" + "y\n" * 50000) * 2 + "z" * 70000
+        self.tempfile()
+        self.run_test("""def _long_lines(filename):\n f=open(filename)\n first = f.readline(70000)\n rest = f.readline()\n lines = [len(l) for l in f]\n f.seek(-5, 2)\n return len(first), len(rest), lines[:3], len(lines), lines[-1], f.read()""", self.filename, _long_lines=[str])
+
+    def test_read_after_readline(self):
+        self.tempfile()
+        self.run_test("""def _read_after_readline(filename):\n f=open(filename)\n l = f.readline()\n t = f.tell()\n return l, t, f.read(3), f.read(), f.read(), f.tell()""", self.filename, _read_after_readline=[str])
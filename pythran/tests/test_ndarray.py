@@ -334,6 +334,11 @@ class TestNdarray(TestEnv):
                       10,
                       filter_array_4=[int])
 
+    def test_filter_array_large(self):
+        self.run_test('def filter_array_large(n): import numpy ; a = numpy.arange(n) ; return a[a % 5 > 2]',
+                      70000,
+                      filter_array_large=[int])
+
     @unittest.skip("filtering a slice")
     def test_filter_array_5(self):
         self.run_test('def filter_array_5(n): import numpy ; a = numpy.arange(n) ; return (a[1:-1])[a[1:-1]>4]',
@@ -653,6 +658,14 @@ def assign_ndarray(t):
                 numpy.array([3,2,1,0], dtype=int),
                 ndarray_fancy_indexing3=[NDArray[float, :, :], NDArray[int, :]])
 
+    def test_ndarray_fancy_indexing4(self):
+        self.run_test("def ndarray_fancy_indexing4(a,b): return a[b]",
+                numpy.arange(30000.).reshape(10000,3),
+                numpy.concatenate((numpy.arange(5000, 9000),
+                                   numpy.arange(-1, -1000, -3),
+                                   numpy.arange(20000) % 7919)),
+                ndarray_fancy_indexing4=[NDArray[float, :, :], NDArray[int, :]])
+
     def test_ndarray_ubyte(self):
         self.run_test("def ndarray_ubyte(n): import numpy; return numpy.arange(0, n, 1, dtype=numpy.ubyte)",
                 4,
@@ -694,3 +707,35 @@ def assign_ndarray(t):
             numpy.arange(30).reshape((1, 2,3,5)),
             numpy_iexpr_3d_index=[NDArray[int, :, :,:, :]])
 
+
+    def test_ndarray_transposed_copy(self):
+        self.run_test(
+            'def ndarray_transposed_copy(a): import numpy as np; return np.ascontiguousarray(a.T)',
+            numpy.arange(70 * 131, dtype=float).reshape((70, 131)),
+            ndarray_transposed_copy=[NDArray[float, :, :]])
+
+    def test_ndarray_transposed_slice_assign(self):
+        self.run_test(
+            'def ndarray_transposed_slice_assign(a, b): b[:] = a.T ; return b',
+            numpy.arange(17 * 65, dtype=numpy.int8).reshape((17, 65)),
+            numpy.zeros((65, 17), dtype=numpy.int8),
+            ndarray_transposed_slice_assign=[NDArray[numpy.int8, :, :],
+                                             NDArray[numpy.int8, :, :]])
+
+    def test_ndarray_transposed_inplace_assign(self):
+        self.run_test(
+            'def ndarray_transposed_inplace_assign(a): a[:] = a.T ; return a',
+            numpy.arange(33 * 33, dtype=numpy.float32).reshape((33, 33)),
+            ndarray_transposed_inplace_assign=[NDArray[numpy.float32, :, :]])
+
+    def test_ndarray_small_temporaries(self):
+        code = '''
+import numpy as np
+def ndarray_small_temporaries(n):
+    out = []
+    for i in range(n):
+        a = np.ones(i % 7 + 1)
+        out.append((a * i).sum() + len([i] * (i % 5)))
+    return np.array(out), np.arange(n)'''
+        self.run_test(code, 1000,
+                      ndarray_small_temporaries=[int])
@@ -1,6 +1,8 @@
 import unittest
+from tempfile import mkstemp
 from test_env import TestEnv
 import numpy
+import os
 import sys
 
 from pythran.typing import NDArray, List, Tuple
@@ -9,6 +11,18 @@ from pythran.typing import NDArray, List, Tuple
 @TestEnv.module
 class TestNumpyFunc0(TestEnv):
 
+    def temporary_file(self, *suffixes):
+        """ Name of an empty file, removed with its suffixed siblings. """
+        fd, name = mkstemp()
+        os.close(fd)
+
+        def cleanup():
+            for path in (name,) + tuple(name + suffix for suffix in suffixes):
+                if os.path.exists(path):
+                    os.remove(path)
+        self.addCleanup(cleanup)
+        return name
+
     def test_extended_sum0(self):
         self.run_test("def numpy_extended_sum0(a): import numpy ; return numpy.sum(a)",
                       numpy.arange(120).reshape((3,5,4,2)),
@@ -245,6 +259,30 @@ def np_rosen_der(x):
     def test_median1(self):
         self.run_test("def np_median1(a): from numpy import median ; return median(a)", numpy.array([1, 2, 3, 4,5]), np_median1=[NDArray[int,:]])
 
+    def test_median2(self):
+        self.run_test("def np_median2(a): from numpy import median ; return median(a, 0)", numpy.arange(30.).reshape(5, 6) % 7, np_median2=[NDArray[float,:,:]])
+
+    def test_median3(self):
+        self.run_test("def np_median3(a): from numpy import median ; return median(a, axis=-1)", numpy.arange(30).reshape(3, 10) % 7, np_median3=[NDArray[int,:,:]])
+
+    def test_partition0(self):
+        self.run_test("def np_partition0(a): from numpy import partition ; return partition(a, 3)[3]", numpy.arange(10)[::-1] % 7, np_partition0=[NDArray[int,:]])
+
+    def test_partition1(self):
+        self.run_test("def np_partition1(a): from numpy import partition ; b = partition(a, [1, 4], axis=0) ; return b[1], b[4]", numpy.arange(60.).reshape(6, 10) % 11, np_partition1=[NDArray[float,:,:]])
+
+    def test_argpartition0(self):
+        self.run_test("def np_argpartition0(a): from numpy import argpartition ; return a[argpartition(a, -2)[-2]]", numpy.arange(10)[::-1] % 7, np_argpartition0=[NDArray[int,:]])
+
+    def test_percentile0(self):
+        self.run_test("def np_percentile0(a): from numpy import percentile ; return percentile(a, 30)", numpy.arange(13.)[::-1], np_percentile0=[NDArray[float,:]])
+
+    def test_percentile1(self):
+        self.run_test("def np_percentile1(a): from numpy import percentile ; return percentile(a, [75., 25.5], 1)", numpy.arange(40).reshape(4, 10) % 9, np_percentile1=[NDArray[int,:,:]])
+
+    def test_quantile0(self):
+        self.run_test("def np_quantile0(a): from numpy import quantile ; return quantile(a, .3, axis=0)", numpy.arange(40.).reshape(8, 5) % 9, np_quantile0=[NDArray[float,:,:]])
+
     def test_mean0(self):
         self.run_test("def np_mean0(a): from numpy import mean ; return mean(a)", numpy.array([[1, 2], [3, 4]]), np_mean0=[NDArray[int,:,:]])
 
@@ -416,6 +454,9 @@ def np_rosen_der(x):
     def test_put2(self):
         self.run_test("def np_put2(x): from numpy import put ; put(x, 2, 57); return x", numpy.arange(6).reshape((2,3)), np_put2=[NDArray[int,:,:]])
 
+    def test_put3(self):
+        self.run_test("def np_put3(x, y): from numpy import put ; put(x, y, [1., 2., 3.]); return x", numpy.zeros(10000), numpy.concatenate((numpy.arange(2000, 8000), numpy.arange(9999, 0, -37))), np_put3=[NDArray[float,:], NDArray[int,:]])
+
     def test_putmask0(self):
         self.run_test("def np_putmask0(x): from numpy import putmask ; putmask(x, x>1, x**2); return x", numpy.arange(6).reshape((2,3)), np_putmask0=[NDArray[int,:,:]])
 
@@ -551,6 +592,15 @@ def np_rosen_der(x):
     def test_sort4(self):
         self.run_test("def np_sort4(a): from numpy import sort ; return sort(a, 1)", numpy.arange(2*3*4, 0, -1).reshape(2,3,4), np_sort4=[NDArray[int, :, :, :]])
 
+    def test_sort5(self):
+        self.run_test("def np_sort5(a): from numpy import sort ; return sort(a, 0, 'mergesort')", numpy.arange(600, 0, -1).reshape(300,2) % 7, np_sort5=[NDArray[int, :, :]])
+
+    def test_sort6(self):
+        self.run_test("def np_sort6(a): from numpy import sort ; return sort(a, kind='mergesort')", numpy.sin(numpy.arange(2 * 700, dtype=numpy.float32)).reshape(2, 700), np_sort6=[NDArray[numpy.float32, :, :]])
+
+    def test_sort7(self):
+        self.run_test("def np_sort7(a): from numpy import sort ; return sort(a, axis=1, kind='heapsort')", numpy.arange(2*3*4, 0, -1).reshape(2,3,4), np_sort7=[NDArray[int, :, :, :]])
+
     def test_sort_complex0(self):
         self.run_test("def np_sort_complex0(a): from numpy import sort_complex ; return sort_complex(a)", numpy.array([[1,6],[7,5]]), np_sort_complex0=[NDArray[int,:,:]])
 
@@ -570,14 +620,15 @@ def np_rosen_der(x):
     def test_take0(self):
         self.run_test("def np_take0(a):\n from numpy import take\n return take(a, [0,1])", numpy.arange(24).reshape(2,3,4), np_take0=[NDArray[int, :, :, :]])
 
-    @unittest.skip("Require numpy_fexpr for multidim array")
     def test_take1(self):
         self.run_test("def np_take1(a):\n from numpy import take\n return take(a, [[0,0,2,2],[1,0,1,2]])", numpy.arange(24).reshape(2,3,4), np_take1=[NDArray[int, :, :, :]])
 
-    @unittest.skip("Require numpy_fexpr with indices")
     def test_take2(self):
         self.run_test("def np_take2(a):\n from numpy import take\n return take(a, [1,0,1,2])", numpy.arange(24), np_take2=[NDArray[int,:]])
 
+    def test_take3(self):
+        self.run_test("def np_take3(a, b):\n from numpy import take\n return take(a, b)", numpy.arange(24.).reshape(2,3,4), numpy.arange(-24, 24000) % 24 - 12, np_take3=[NDArray[float, :, :, :], NDArray[int, :]])
+
     def test_swapaxes_(self):
         self.run_test("def np_swapaxes_(a):\n from numpy import swapaxes\n return swapaxes(a, 1, 2)", numpy.arange(24).reshape(2,3,4), np_swapaxes_=[NDArray[int, :, :, :]])
 
@@ -604,6 +655,42 @@ def np_rosen_der(x):
     def test_tostring1(self):
         self.run_test("def np_tostring1(a): return a.tostring()", numpy.arange(500, 600), np_tostring1=[NDArray[int,:]])
 
+    def test_fromfile0(self):
+        self.run_test("def np_fromfile0(a, fn): from numpy import fromfile, float64 ; a.tofile(fn) ; return fromfile(fn, float64)", numpy.arange(10.), self.temporary_file(), np_fromfile0=[NDArray[float,:], str])
+
+    def test_fromfile1(self):
+        self.run_test("def np_fromfile1(a, fn): from numpy import fromfile, int64 ; a.tofile(fn, ' ') ; return fromfile(fn, int64, 4, ' ')", numpy.arange(10), self.temporary_file(), np_fromfile1=[NDArray[int,:], str])
+
+    def test_fromfile_sep(self):
+        self.run_test("def np_fromfile_sep(a, fn): from numpy import fromfile, int64 ; a.tofile(fn, ', ') ; return fromfile(fn, int64, -1, ', '), fromfile(fn, int64, 3, ' , ')", numpy.arange(10), self.temporary_file(), np_fromfile_sep=[NDArray[int,:], str])
+
+    def test_fromfile2(self):
+        self.run_test("def np_fromfile2(a, fn): from numpy import fromfile, uint8 ; a.tofile(open(fn, 'w')) ; return fromfile(open(fn), uint8, 3)", numpy.arange(24.).reshape(2, 3, 4), self.temporary_file(), np_fromfile2=[NDArray[float,:,:,:], str])
+
+    def test_save0(self):
+        self.run_test("def np_save0(a, fn): from numpy import save, fromfile, uint8 ; save(fn, a) ; b = fromfile(fn + '.npy', uint8) ; return b[:8], b[-a.size * 8:]", numpy.arange(12).reshape(3, 4), self.temporary_file('.npy'), np_save0=[NDArray[int,:,:], str])
+
+    def test_memmap0(self):
+        self.run_test("def np_memmap0(a, fn): from numpy import memmap, int64 ; a.tofile(fn) ; m = memmap(fn, int64, 'r', 8, (2, 3)) ; return m.sum(), m[1, 2]", numpy.arange(10), self.temporary_file(), np_memmap0=[NDArray[int,:], str])
+
+    def test_memmap1(self):
+        self.run_test("def np_memmap1(a, fn): from numpy import memmap, float64 ; a.tofile(fn) ; m = memmap(fn, float64) ; m[0] = 3. ; return open(fn).read(8)", numpy.arange(10.), self.temporary_file(), np_memmap1=[NDArray[float,:], str])
+
+    def test_memmap2(self):
+        code = "def np_memmap2(fn): from numpy import memmap, int64 ; return memmap(fn, int64, 'r')"
+        runas = """
+import numpy
+fn = {!r}
+numpy.arange(4).tofile(fn)
+m = np_memmap2(fn)
+try:
+    m[0] = 1
+    written = True
+except ValueError:
+    written = False
+;written, int(m.sum())""".format(self.temporary_file())
+        self.run_test_case(code, 'test_memmap2', runas, np_memmap2=[str])
+
     def test_fromiter0(self):
         self.run_test("def g(): yield 1 ; yield 2\ndef np_fromiter0(): from numpy import fromiter, float32 ; iterable = g() ; return fromiter(iterable, float32)", np_fromiter0=[])
 
@@ -643,6 +730,9 @@ def np_rosen_der(x):
     def test_flatnonzero1(self):
         self.run_test("def np_flatnonzero1(x): from numpy import flatnonzero ;  return flatnonzero(x[1:-1])", numpy.arange(-2, 3), np_flatnonzero1=[NDArray[int,:]])
 
+    def test_flatnonzero2(self):
+        self.run_test("def np_flatnonzero2(x): from numpy import flatnonzero ;  return flatnonzero(x)", numpy.array([0., -0., numpy.nan, 1.] * 10001), np_flatnonzero2=[NDArray[float,:]])
+
     def test_fix0(self):
         self.run_test("def np_fix0(x): from numpy import fix ; return fix(x)", 3.14, np_fix0=[float])
 
@@ -14,6 +14,21 @@ class TestNumpyFunc1(TestEnv):
     def test_sum_expr(self):
         self.run_test("def np_sum_expr(a):\n from numpy import ones\n return (a + ones(10)).sum()", numpy.arange(10), np_sum_expr=[NDArray[int,:]])
 
+    def test_sum_float32_accuracy(self):
+        self.run_test("def np_sum_float32_accuracy(a): return abs(a.sum() - 100000.) < 1.", numpy.full(10**6, .1, dtype=numpy.float32), np_sum_float32_accuracy=[NDArray[numpy.float32,:]])
+
+    def test_sum_int8_widening(self):
+        self.run_test("def np_sum_int8_widening(a): return a.sum()", numpy.full(1000, 100, dtype=numpy.int8), np_sum_int8_widening=[NDArray[numpy.int8,:]])
+
+    def test_sum_axis0_float32_accuracy(self):
+        self.run_test("def np_sum_axis0_float32_accuracy(a): return (abs(a.T.sum(axis=0) - 100000.) < 1.).all()", numpy.full((2, 10**6), .1, dtype=numpy.float32), np_sum_axis0_float32_accuracy=[NDArray[numpy.float32,:,:]])
+
+    def test_sum_axis_pairwise(self):
+        self.run_test("def np_sum_axis_pairwise(a): return a.sum(axis=0), a.sum(axis=1), a.sum(axis=2)", numpy.arange(1000. * 300 * 2).reshape(1000, 300, 2), np_sum_axis_pairwise=[NDArray[float,:,:,:]])
+
+    def test_mean_var_axis_pairwise(self):
+        self.run_test("def np_mean_var_axis_pairwise(a): return a.mean(axis=0), a.var(axis=0), a.var(axis=1)", numpy.arange(3000.).reshape(1000, 3) ** .5, np_mean_var_axis_pairwise=[NDArray[float,:,:]])
+
     def test_sum2_(self):
         self.run_test("def np_sum2_(a): return a.sum()", numpy.arange(10).reshape(2,5), np_sum2_=[NDArray[int,:,:]])
 
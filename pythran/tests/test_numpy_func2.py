@@ -17,6 +17,9 @@ class TestNumpyFunc2(TestEnv):
     def test_nonzero2(self):
         self.run_test("def np_nonzero2(x): from numpy import nonzero ; return nonzero(x>0)", numpy.arange(6).reshape(2,3), np_nonzero2=[NDArray[int,:,:]])
 
+    def test_nonzero3(self):
+        self.run_test("def np_nonzero3(x): from numpy import nonzero ; return nonzero(x % 7 == 3)", numpy.arange(40000).reshape(5,80,100), np_nonzero3=[NDArray[int,:,:,:]])
+
     def test_diagflat3(self):
         self.run_test("def np_diagflat3(a): from numpy import diagflat ; return diagflat(a)", numpy.arange(2), np_diagflat3=[NDArray[int,:]])
 
@@ -124,6 +127,9 @@ class TestNumpyFunc2(TestEnv):
     def test_cumprod5_(self):
         self.run_test("def np_cumprod5_(a):\n from numpy import cumprod\n return a.cumprod(0)", numpy.arange(10), np_cumprod5_=[NDArray[int,:]])
 
+    def test_cumprod6_(self):
+        self.run_test("def np_cumprod6_(a):\n from numpy import cumprod\n return a.cumprod(0)", numpy.arange(1, 61).reshape(3,4,5) % 3 + 1, np_cumprod6_=[NDArray[int,:,:,:]])
+
     def test_copy0(self):
         code= '''
 def test_copy0(x):
@@ -358,6 +364,9 @@ def test_copy0(x):
     def test_argwhere2(self):
         self.run_test("def np_argwhere2(x): from numpy import argwhere ; return argwhere(x>0)", numpy.arange(6).reshape(2,3), np_argwhere2=[NDArray[int,:,:]])
 
+    def test_argwhere3(self):
+        self.run_test("def np_argwhere3(x): from numpy import argwhere ; return argwhere(x)", numpy.arange(40000).reshape(400,100) % 3, np_argwhere3=[NDArray[int,:,:]])
+
     def test_around0(self):
         self.run_test("def np_around0(x): from numpy import around ; return around(x)", [0.37, 1.64], np_around0=[List[float]])
 
@@ -686,6 +695,12 @@ def np_broadcast_dup():
     def test_cumsum5_(self):
         self.run_test("def np_cumsum5_(a): return a.cumsum(0)", numpy.arange(10), np_cumsum5_=[NDArray[int,:]])
 
+    def test_cumsum6_(self):
+        self.run_test("def np_cumsum6_(a): return (a % 7 - 3).cumsum()", numpy.arange(100003), np_cumsum6_=[NDArray[int,:]])
+
+    def test_cumsum7_(self):
+        self.run_test("def np_cumsum7_(a): return (a % 5).cumsum(1)", numpy.arange(60).reshape(3,4,5), np_cumsum7_=[NDArray[int,:,:,:]])
+
     def test_sum_(self):
         self.run_test("def np_sum_(a): return a.sum()", numpy.arange(10), np_sum_=[NDArray[int,:]])
 
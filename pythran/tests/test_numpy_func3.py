@@ -205,6 +205,55 @@ class TestNumpyFunc3(TestEnv):
                       numpy.array(numpy.arange(18.).reshape(6,3)),
                       np_dot19=[NDArray[float,:,:], NDArray[float,:,:]])
 
+    def test_dot20(self):
+        """ Check for packed dot with "no blas type" and strided args larger
+        than a block"""
+        self.run_test("""
+        def np_dot20(x, y):
+            from numpy import dot
+            return dot(x[::2, 1:], y.T)""",
+                      numpy.arange(300 * 281).reshape(300, 281) % 7 - 3,
+                      numpy.arange(1030 * 280).reshape(1030, 280) % 5 - 2,
+                      np_dot20=[NDArray[int,:,:], NDArray[int,:,:]])
+
+    def test_dot21(self):
+        """ Check for dot gemv and gevm with mixed "no blas types" """
+        self.run_test("""
+        def np_dot21(x, y):
+            from numpy import dot
+            return dot(x.T, y), dot(y, x)""",
+                      numpy.arange(60, dtype=numpy.int32).reshape(12, 5),
+                      numpy.arange(12, dtype=numpy.int64),
+                      np_dot21=[NDArray[numpy.int32,:,:],
+                                NDArray[numpy.int64,:]])
+
+    def test_dot22(self):
+        """ Check for dot with blas type on sliced and transposed args, which
+        blas reads in place"""
+        self.run_test("""
+        def np_dot22(x, y):
+            from numpy import dot
+            return (dot(x[1::2, 3:33], y[:30]),
+                    dot(x[::2, 1:31].T, y[:, :30].T),
+                    dot(x[2:32, :50], y[::-1, :40]),
+                    dot(x[3:33, ::2], y[:30, :30].T))""",
+                      numpy.arange(60 * 60.).reshape(60, 60) % 11 - 5,
+                      numpy.arange(50 * 60.).reshape(50, 60) % 7 - 3,
+                      np_dot22=[NDArray[float,:,:], NDArray[float,:,:]])
+
+    def test_dot23(self):
+        """ Check for dot gemv and gevm with blas type on sliced and
+        transposed args"""
+        self.run_test("""
+        def np_dot23(x, y):
+            from numpy import dot
+            return (dot(x[1::2, 3:33], y[::2]), dot(x[:30].T, y[:30]),
+                    dot(y[1::2], x[::2, :]), dot(x[4], x[10:40].T),
+                    dot(x[:30, :30], y[29::-1]))""",
+                      numpy.arange(60 * 60.).reshape(60, 60) % 11 - 5,
+                      numpy.arange(60.) % 5 - 2,
+                      np_dot23=[NDArray[float,:,:], NDArray[float,:]])
+
 
 
     def test_digitize0(self):
@@ -300,6 +349,15 @@ def np_trim_zeros2(x):
     def test_unique3(self):
         self.run_test("def np_unique3(x): from numpy import unique ; return unique(x, True, True)", numpy.array([1,1,2,2,2,1,5]), np_unique3=[NDArray[int,:]])
 
+    def test_unique4(self):
+        self.run_test("def np_unique4(x): from numpy import unique ; return unique(x, True, True, True)", numpy.arange(3000) % 17 - 8, np_unique4=[NDArray[int,:]])
+
+    def test_unique5(self):
+        self.run_test("def np_unique5(x): from numpy import unique ; return unique(x, True, True, True)", numpy.cos(numpy.arange(3000.)).round(2), np_unique5=[NDArray[float,:]])
+
+    def test_unique6(self):
+        self.run_test("def np_unique6(x): from numpy import unique ; return unique(x)", numpy.arange(5000)[::-1] * 7 % 1009, np_unique6=[NDArray[int,:]])
+
     def test_unwrap0(self):
         self.run_test("def np_unwrap0(x): from numpy import unwrap, pi ; x[:3] += 2*pi; return unwrap(x)", numpy.arange(6, dtype=float), np_unwrap0=[NDArray[float,:]])
 
@@ -36,6 +36,18 @@ class TestNumpyRandom(TestEnv):
                 return (abs(s / (n * n) - .5) < 5e-3)""",
                       10 ** 3, numpy_random2=[int])
 
+    def test_numpy_random_seed0(self):
+        """ Check numpy random draws are reproducible after a seed. """
+        self.run_test("""
+            def numpy_random_seed0(n):
+                from numpy.random import seed, random, normal, randint
+                seed(42)
+                a, b, c, d = random(n), normal(0., 1., n), randint(0, 10, n), random()
+                seed(42)
+                e, f, g, h = random(n), normal(0., 1., n), randint(0, 10, n), random()
+                return (a == e).all() and (b == f).all() and (c == g).all() and d == h""",
+                      10 ** 5, numpy_random_seed0=[int])
+
     ###########################################################################
     # Tests for numpy.random.random_sample
     ###########################################################################
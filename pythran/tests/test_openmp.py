@@ -36,6 +36,56 @@ class TestOpenMPLegacy(TestFromDir):
     def extract_runas(name, filepath):
         return ['#runas {}()'.format(name)]
 
+
+class TestThreadEscape(unittest.TestCase):
+    '''
+    Check that reference counts stay atomic when a value reaches several
+    threads
+    '''
+
+    def preamble(self, code, specs):
+        module, _ = pythran.generate_cxx("escape", code, specs)
+        return str(module)
+
+    def test_local_list(self):
+        code = """
+def local_list():
+    total = 0
+    #omp parallel for reduction(+:total)
+    for i in range(1000):
+        l = [i, i + 1]
+        total += len(l)
+    return total"""
+        cxx = self.preamble(code, {'local_list': ([],)})
+        self.assertIn("PYTHRAN_NON_ATOMIC_REFCOUNT", cxx)
+
+    def test_returned_list(self):
+        code = """
+def returned_list():
+    rows = [[0] for i in range(1000)]
+    #omp parallel for
+    for i in range(1000):
+        rows[i] = [i, i + 1]
+    return rows"""
+        cxx = self.preamble(code, {'returned_list': ([],)})
+        self.assertNotIn("PYTHRAN_NON_ATOMIC_REFCOUNT", cxx)
+
+    def test_task_list(self):
+        code = """
+def task_list():
+    total = 0
+    #omp parallel
+    #omp single
+    for i in range(1000):
+        l = [i, i + 1]
+        #omp task firstprivate(l)
+        #omp atomic
+        total += len(l)
+    return total"""
+        cxx = self.preamble(code, {'task_list': ([],)})
+        self.assertNotIn("PYTHRAN_NON_ATOMIC_REFCOUNT", cxx)
+
+
 # only activate OpenMP tests if the underlying compiler supports OpenMP
 try:
     pythran.compile_cxxcode("omp", '#include <omp.h>',
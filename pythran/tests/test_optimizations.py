@@ -59,6 +59,25 @@ def listcomptomap_alias(n):
     return list([x for x in xrange(n)])
 """, 10, listcomptomap_alias=[int])
 
+    def test_parallel_map(self):
+        self.run_test("""
+def parallel_map(n):
+    return [x * x + 1. for x in xrange(n)], map(str, xrange(n))
+""", 2000, parallel_map=[int])
+
+    def test_parallel_map_raise(self):
+        self.run_test("""
+def parallel_map_raise(l):
+    return [1 / (x - 1500) for x in l]
+""", list(range(2000)), parallel_map_raise=[List[int]],
+            check_exception=True)
+
+    def test_parallel_map_none(self):
+        self.run_test("""
+def parallel_map_none(l):
+    return list(map(None, l, l))
+""", [1, 2, 3], parallel_map_none=[List[int]])
+
     def test_readonce_return(self):
         self.run_test("""
 def foo(l):
@@ -198,3 +198,24 @@ def are_equal(s1):
     def test_print_empty_set(self):
         self.run_test("def print_empty_set(s): return str(s)", set(), print_empty_set=[Set[int]])
 
+
+    def test_dense_set_operations(self):
+        code = '''
+def dense_set_operations(n):
+    a = {i for i in range(-n, n, 2)}
+    b = {i for i in range(n, -n, -3)}
+    return a | b, a & b, a - b, a ^ b, a <= b, (a & b) <= a, a.isdisjoint(b)'''
+        self.run_test(code, 1000, dense_set_operations=[int])
+
+    def test_sparse_set_operations(self):
+        code = '''
+def sparse_set_operations(n):
+    a = {i * i * 7919 for i in range(n)}
+    b = {i for i in range(n)}
+    a.update(b)
+    c = a.copy()
+    c.intersection_update(range(0, 10 * n, 3))
+    a.difference_update(c)
+    d = c.copy()
+    return a, c, b <= a, len(a), sorted(d.pop() for _ in range(len(c)))'''
+        self.run_test(code, 200, sparse_set_operations=[int])
@@ -0,0 +1,71 @@
+from imp import load_dynamic
+import numpy as np
+import pythran
+
+import os
+import unittest
+
+
+class TestSplit(unittest.TestCase):
+
+    code = '''
+#pythran export scale(float[], float)
+#pythran export scale(int[], int)
+#pythran export total(int list)
+#pythran export total(float list)
+#pythran export norm(float[])
+#pythran export offset
+import numpy as np
+offset = 3
+def scale(a, f): return a * f + offset
+def total(l): return sum(l)
+def norm(a): return np.sqrt(np.sum(a * a))'''
+
+    def test_split_module(self):
+        output = pythran.compile_pythrancode('test_split_module', self.code,
+                                             jobs=3, cache=False)
+        try:
+            module = load_dynamic('test_split_module', output)
+            np.testing.assert_array_equal(module.scale(np.arange(3.), 2.),
+                                          [3., 5., 7.])
+            np.testing.assert_array_equal(module.scale(np.arange(3), 2),
+                                          [3, 5, 7])
+            self.assertEqual(module.total([1, 2, 3]), 6)
+            self.assertEqual(module.total([.5, .25]), .75)
+            self.assertEqual(module.norm(np.array([3., 4.])), 5.)
+            self.assertEqual(module.offset, 3)
+        finally:
+            os.remove(output)
+
+    def test_split_random_state(self):
+        # each function lands in its own unit, the seed must reach all
+        code = '''
+#pythran export seed(int)
+#pythran export draw()
+#pythran export draws(int)
+#pythran export pick()
+import numpy as np
+import random
+def seed(n):
+    np.random.seed(n)
+    random.seed(n)
+def draw(): return np.random.random()
+def draws(n): return np.random.random(n)
+def pick(): return random.random()'''
+        output = pythran.compile_pythrancode('test_split_random_state', code,
+                                             jobs=5, cache=False)
+        try:
+            module = load_dynamic('test_split_random_state', output)
+            module.seed(42)
+            first = module.draw(), module.draws(3), module.pick()
+            module.seed(42)
+            second = module.draw(), module.draws(3), module.pick()
+            self.assertEqual(first[0], second[0])
+            np.testing.assert_array_equal(first[1], second[1])
+            self.assertEqual(first[2], second[2])
+        finally:
+            os.remove(output)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -114,3 +114,31 @@ class TestStr(TestEnv):
         self.run_test("def str_count(s, t, u, v): return s.count(t), s.count(u), s.count(v)",
                       "pythran is good for health", "py", "niet", "t",
                       str_count=[str, str, str, str])
+
+    def test_str_split_tokens(self):
+        self.run_test("""
+def str_split_tokens(s):
+    counts = {}
+    total = 0
+    for tok in s.split(','):
+        tok = tok.strip()
+        counts[tok] = counts.get(tok, 0) + 1
+        total += int(tok[1:])
+    return sorted(counts.items()), total""",
+                      " x12, y3 ,x12,z45 ", str_split_tokens=[str])
+
+    def test_str_slice_of_strip(self):
+        self.run_test("def str_slice_of_strip(s): t = s.strip()[2:-1]; return t, t.upper(), t.lstrip('a'), t.rstrip('d') + t[::2], t.find('d')",
+                      "  xxaabcdd  ", str_slice_of_strip=[str])
+
+    def test_str_sliced(self):
+        self.run_test("def str_sliced(s): return s[1:4], s[2:], s[::2], s[::-3], s[1:-1][1:], int(s[1:3]), open('/dev/null'[:9]).read()",
+                      "4213579", str_sliced=[str])
+
+    def test_str_replace_empty(self):
+        self.run_test("def str_replace_empty(s): return s.replace('', '-'), s.replace('', '-', 2), s.replace('ab', 'xyz')",
+                      "abcab", str_replace_empty=[str])
+
+    def test_str_classes(self):
+        self.run_test("def str_classes(s, t): return s.isdigit(), t.isdigit(), s.isalpha(), t.isalpha(), t.upper(), t.lower(), t.capitalize()",
+                      "0123456789" * 5, "azAZ@[`{" * 5, str_classes=[str, str])
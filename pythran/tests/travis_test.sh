@@ -12,8 +12,13 @@ run_tests() {
         PYTHONPATH=$PWD:$PYTHONPATH py.test pythran/tests/notebooks --nbval
         exit
     fi
-    printf "[compiler]\nCXX=$CXX\nCC=$CC\ncflags=-std=c++11 $CXXFLAGS -w\nldflags=$CXXFLAGS\n" > ~/.pythranrc
+    # modules and precompiled headers are cached apart from the user ones
+    CACHE_DIR=$(mktemp -d)
+    printf "[compiler]\nCXX=$CXX\nCC=$CC\ncflags=-std=c++11 $CXXFLAGS -w\nldflags=$CXXFLAGS\n[pythran]\ncache_dir=$CACHE_DIR\n" > ~/.pythranrc
     OMP_NUM_THREADS=4 PYTHONPATH=$PWD:$PYTHONPATH py.test -v $TESTCASE
+    STATUS=$?
+    rm -rf $CACHE_DIR
+    return $STATUS
 }
 
 # Test with both clang and gcc
@@ -3,13 +3,16 @@ This module contains all the stuff to make your way from python code to
 a dynamic library, see __init__.py for exported interfaces.
 '''
 
+from pythran.analyses import ThreadEscape
 from pythran.backend import Cxx, Python
+from pythran.cache import cache_dir, cache_key, lookup, store
 from pythran.config import cfg, make_extension
 from pythran.cxxgen import PythonModule, Define, Include, Line, Statement
 from pythran.cxxgen import FunctionBody, FunctionDeclaration, Value, Block
 from pythran.cxxgen import ReturnStatement
 from pythran.middlend import refine
 from pythran.passmanager import PassManager
+from pythran.pch import bundle as pch_bundle, precompiled_header
 from pythran.tables import pythran_ward
 from pythran.types import tog
 from pythran.types.types import extract_constructed_types
@@ -199,19 +202,19 @@ def generate_cxx(module_name, code, specs=None, optimizations=None):
 
         mod = PythonModule(module_name, docstrings, metainfo)
         mod.add_to_preamble(Define("BOOST_SIMD_NO_STRICT_ALIASING", "1"))
-        mod.add_to_includes(
-            Include("pythonic/core.hpp"),
-            Include("pythonic/python/core.hpp"),
-            # FIXME: only include these when needed
-            Include("pythonic/types/bool.hpp"),
-            Include("pythonic/types/int.hpp"),
-            Line("#ifdef _OPENMP\n#include <omp.h>\n#endif")
-        )
+        # reference counts need no atomics if no value is shared by threads
+        if not pm.gather(ThreadEscape, ir):
+            mod.add_to_preamble(Define("PYTHRAN_NON_ATOMIC_REFCOUNT", "1"))
+        # the bundle ends the preamble, before the definitions specific to
+        # a translation unit, so that all units share its precompiled form
+        mod.add_to_preamble(*[Include(inc) for inc in pch_bundle])
+        mod.add_to_includes(Line("#ifdef _OPENMP\n#include <omp.h>\n#endif"))
         mod.add_to_includes(*[Include(inc) for inc in
                               _extract_specs_dependencies(specs)])
         mod.add_to_includes(*content.body)
         mod.add_to_includes(
             Include("pythonic/python/exception_handler.hpp"),
+            Include("pythonic/python/dispatch.hpp"),
         )
 
         def warded(module_name, internal_name):
@@ -301,23 +304,50 @@ def generate_cxx(module_name, code, specs=None, optimizations=None):
     return mod, error_checker
 
 
-def compile_cxxfile(module_name, cxxfile, output_binary=None, **kwargs):
-    '''c++ file -> native module
+def compile_cxxfiles(module_name, cxxfiles, output_binary=None, cache=True,
+                     jobs=1, **kwargs):
+    '''c++ files -> native module
     Return the filename of the produced shared library
     Raises CompileError on failure
 
+    The translation units `cxxfiles` are compiled by `jobs` concurrent
+    compiler processes, then linked together.
+
+    Unless `cache` is False, a module previously compiled from the same C++
+    code with the same compiler and flags is reused, new modules are added to
+    the cache, and the pythonic headers they start with are precompiled.
     '''
 
+    extension_args = make_extension(**kwargs)
+
+    key = None
+    if cache and cache_dir():
+        key = cache_key(module_name, cxxfiles, extension_args)
+        cached = lookup(key)
+        if cached:
+            if not output_binary:
+                output_binary = os.path.join(
+                    os.getcwd(), module_name + os.path.splitext(cached)[1])
+            shutil.copy(cached, output_binary)
+            logger.info("Output: " + output_binary)
+            return output_binary
+
+    # the header is included by every translation unit, so they must all
+    # start the same way
+    header = cache and precompiled_header(cxxfiles, extension_args)
+    if header:
+        extension_args['extra_compile_args'] += ['-include', header]
+
     builddir = mkdtemp()
     buildtmp = mkdtemp()
 
-    extension_args = make_extension(**kwargs)
-
     extension = Extension(module_name,
-                          [cxxfile],
+                          list(cxxfiles),
                           language="c++",
                           **extension_args)
 
+    build_args = ['--parallel', str(jobs)] if jobs > 1 else []
+
     try:
         setup(name=module_name,
               ext_modules=[extension],
@@ -326,8 +356,8 @@ def compile_cxxfile(module_name, cxxfile, output_binary=None, **kwargs):
               script_args=['--verbose'
                            if logger.isEnabledFor(logging.INFO)
                            else '--quiet',
-                           'build_ext',
-                           '--build-lib', builddir,
+                           'build_ext'] + build_args +
+                          ['--build-lib', builddir,
                            '--build-temp', buildtmp]
               )
     except SystemExit as e:
@@ -341,41 +371,62 @@ def compile_cxxfile(module_name, cxxfile, output_binary=None, **kwargs):
     shutil.rmtree(builddir)
     shutil.rmtree(buildtmp)
 
+    if key:
+        store(key, output_binary)
+
     logger.info("Generated module: " + module_name)
     logger.info("Output: " + output_binary)
 
     return output_binary
 
 
+def compile_cxxfile(module_name, cxxfile, output_binary=None, **kwargs):
+    '''c++ file -> native module
+    Return the filename of the produced shared library
+    Raises CompileError on failure
+
+    '''
+    return compile_cxxfiles(module_name, [cxxfile], output_binary, **kwargs)
+
+
 def compile_cxxcode(module_name, cxxcode, output_binary=None, keep_temp=False,
                     **kwargs):
     '''c++ code (string) -> temporary file -> native module.
     Returns the generated .so.
 
+    `cxxcode` may also be a list holding the code of several translation
+    units.
     '''
 
-    # Get a temporary C++ file to compile
-    fdpath = _write_temp(cxxcode, '.cpp')
-    output_binary = compile_cxxfile(module_name, fdpath,
-                                    output_binary, **kwargs)
-    if not keep_temp:
-        # remove tempfile
-        os.remove(fdpath)
-    else:
-        logger.warn("Keeping temporary generated file:" + fdpath)
+    if not isinstance(cxxcode, list):
+        cxxcode = [cxxcode]
+
+    # Get temporary C++ files to compile
+    fdpaths = [_write_temp(code, '.cpp') for code in cxxcode]
+    output_binary = compile_cxxfiles(module_name, fdpaths,
+                                     output_binary, **kwargs)
+    for fdpath in fdpaths:
+        if not keep_temp:
+            # remove tempfile
+            os.remove(fdpath)
+        else:
+            logger.warn("Keeping temporary generated file:" + fdpath)
 
     return output_binary
 
 
 def compile_pythrancode(module_name, pythrancode, specs=None,
                         opts=None, cpponly=False, pyonly=False,
-                        output_file=None, **kwargs):
+                        output_file=None, jobs=1, **kwargs):
     '''Pythran code (string) -> c++ code -> native module
 
     if `cpponly` is set to true, return the generated C++ filename
     if `pyonly` is set to true, prints the generated Python filename,
        unless `output_file` is set
     otherwise, return the generated native library filename
+
+    if `jobs` is greater than 1, the C++ code is split into that many
+    translation units, compiled concurrently
     '''
 
     if pyonly:
@@ -409,8 +460,9 @@ def compile_pythrancode(module_name, pythrancode, specs=None,
         # Compile to binary
         try:
             output_file = compile_cxxcode(module_name,
-                                          str(module),
+                                          module.split(jobs),
                                           output_binary=output_file,
+                                          jobs=jobs,
                                           **kwargs)
         except CompileError as ce:
             logger.warn("Compilation error, trying hard to find its origin...")